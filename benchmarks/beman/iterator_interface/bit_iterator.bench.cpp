@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/bit_iterator.bench.cpp -*-C++-*-
+
+// count, find, fill, copy and equal over a bitmap of 16M bits, bit by bit with
+// the standard algorithms on bit_iterator and on std::vector<bool>, and a word
+// at a time with the algorithm.hpp functions.  The ranges start and end inside
+// words, and copy shifts the bits by a few places, as for bitmap index slices.
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/bit_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = std::ptrdiff_t(1) << 24;
+
+// The range [first, last) of the bitmap.
+constexpr std::ptrdiff_t first = 3;
+constexpr std::ptrdiff_t last  = size - 5;
+
+std::vector<std::uint64_t> make_words() {
+    std::mt19937_64            gen(42);
+    std::vector<std::uint64_t> words(size / 64 + 1);
+    for (auto& w : words)
+        w = gen();
+    return words;
+}
+
+std::vector<bool> make_bools() {
+    const auto        words = make_words();
+    std::vector<bool> v(words.size() * 64);
+    std::copy_n(bii::bit_iterator<const std::uint64_t>(words.data()), v.size(), v.begin());
+    return v;
+}
+
+void items(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (last - first)));
+}
+
+void BM_CountBitwise(benchmark::State& state) {
+    const auto                                   words = make_words();
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::count(b + first, b + last, true));
+    items(state);
+}
+
+void BM_CountVectorBool(benchmark::State& state) {
+    const auto v = make_bools();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::count(v.begin() + first, v.begin() + last, true));
+    items(state);
+}
+
+void BM_CountWords(benchmark::State& state) {
+    const auto                                   words = make_words();
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bii::algorithms::count(b + first, b + last, true));
+    items(state);
+}
+
+// The only set bit of the range is its last.
+std::vector<std::uint64_t> make_sparse() {
+    std::vector<std::uint64_t> words(size / 64 + 1);
+    bii::bit_iterator<std::uint64_t>(words.data())[last - 1] = true;
+    return words;
+}
+
+void BM_FindBitwise(benchmark::State& state) {
+    const auto                                   words = make_sparse();
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::find(b + first, b + last, true));
+    items(state);
+}
+
+void BM_FindWords(benchmark::State& state) {
+    const auto                                   words = make_sparse();
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bii::algorithms::find(b + first, b + last, true));
+    items(state);
+}
+
+void BM_FillBitwise(benchmark::State& state) {
+    auto                                   words = make_words();
+    const bii::bit_iterator<std::uint64_t> b(words.data());
+    bool                                   value = false;
+    for (auto _ : state) {
+        std::fill(b + first, b + last, value = !value);
+        benchmark::DoNotOptimize(words.data());
+    }
+    items(state);
+}
+
+void BM_FillVectorBool(benchmark::State& state) {
+    auto v     = make_bools();
+    bool value = false;
+    for (auto _ : state) {
+        std::fill(v.begin() + first, v.begin() + last, value = !value);
+        benchmark::DoNotOptimize(v);
+    }
+    items(state);
+}
+
+void BM_FillWords(benchmark::State& state) {
+    auto                                   words = make_words();
+    const bii::bit_iterator<std::uint64_t> b(words.data());
+    bool                                   value = false;
+    for (auto _ : state) {
+        bii::algorithms::fill(b + first, b + last, value = !value);
+        benchmark::DoNotOptimize(words.data());
+    }
+    items(state);
+}
+
+void BM_CopyBitwise(benchmark::State& state) {
+    const auto                                   words = make_words();
+    std::vector<std::uint64_t>                   out(words.size());
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state) {
+        std::copy(b + first, b + last, bii::bit_iterator<std::uint64_t>(out.data(), 1));
+        benchmark::DoNotOptimize(out.data());
+    }
+    items(state);
+}
+
+void BM_CopyVectorBool(benchmark::State& state) {
+    const auto        v = make_bools();
+    std::vector<bool> out(v.size());
+    for (auto _ : state) {
+        std::copy(v.begin() + first, v.begin() + last, out.begin() + 1);
+        benchmark::DoNotOptimize(out);
+    }
+    items(state);
+}
+
+void BM_CopyWords(benchmark::State& state) {
+    const auto                                   words = make_words();
+    std::vector<std::uint64_t>                   out(words.size());
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state) {
+        bii::algorithms::copy(b + first, b + last, bii::bit_iterator<std::uint64_t>(out.data(), 1));
+        benchmark::DoNotOptimize(out.data());
+    }
+    items(state);
+}
+
+void BM_EqualBitwise(benchmark::State& state) {
+    const auto                                   words = make_words();
+    const auto                                   copy  = words;
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    const bii::bit_iterator<const std::uint64_t> c(copy.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::equal(b + first, b + last, c + first));
+    items(state);
+}
+
+void BM_EqualWords(benchmark::State& state) {
+    const auto                                   words = make_words();
+    const auto                                   copy  = words;
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    const bii::bit_iterator<const std::uint64_t> c(copy.data());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bii::algorithms::equal(b + first, b + last, c + first));
+    items(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_CountBitwise);
+BENCHMARK(BM_CountVectorBool);
+BENCHMARK(BM_CountWords);
+BENCHMARK(BM_FindBitwise);
+BENCHMARK(BM_FindWords);
+BENCHMARK(BM_FillBitwise);
+BENCHMARK(BM_FillVectorBool);
+BENCHMARK(BM_FillWords);
+BENCHMARK(BM_CopyBitwise);
+BENCHMARK(BM_CopyVectorBool);
+BENCHMARK(BM_CopyWords);
+BENCHMARK(BM_EqualBitwise);
+BENCHMARK(BM_EqualWords);
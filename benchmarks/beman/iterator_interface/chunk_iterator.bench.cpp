@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/chunk_iterator.bench.cpp -*-C++-*-
+
+// 1M floats processed one element at a time and in chunks of state.range(0)
+// elements: summing them, where the batch kernel keeps independent partial
+// sums that the compiler vectorizes while the element-wise loop is a chain of
+// dependent additions, and writing them to a sink through an opaque call, one
+// per element or one per chunk.
+
+#include <beman/iterator_interface/chunk_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::size_t size = std::size_t(1) << 20;
+
+std::vector<float> make_values() {
+    std::vector<float> v(size);
+    std::iota(v.begin(), v.end(), 0.0f);
+    return v;
+}
+
+float sum_batch(std::span<const float> batch) {
+    constexpr std::size_t    lanes = 16;
+    std::array<float, lanes> partial{};
+    std::size_t              i = 0;
+    for (; i + lanes <= batch.size(); i += lanes) {
+        for (std::size_t j = 0; j != lanes; ++j)
+            partial[j] += batch[i + j];
+    }
+    float sum = std::accumulate(partial.begin(), partial.end(), 0.0f);
+    for (; i != batch.size(); ++i)
+        sum += batch[i];
+    return sum;
+}
+
+void BM_SumElementwise(benchmark::State& state) {
+    const auto v = make_values();
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (float x : v)
+            sum += x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_SumChunked(benchmark::State& state) {
+    const auto v = make_values();
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::span<const float> chunk : bii::chunks(v, state.range(0)))
+            sum += sum_batch(chunk);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+// A ring buffer standing for a file or socket, written through a function
+// pointer that the compiler cannot see through, as for a library I/O call.
+struct sink {
+    std::array<std::byte, 1 << 16> buffer;
+    std::size_t                    pos = 0;
+};
+
+void write_bytes(sink& s, const void* data, std::size_t n) {
+    const auto* p = static_cast<const std::byte*>(data);
+    while (n != 0) {
+        const std::size_t k = std::min(n, s.buffer.size() - s.pos);
+        std::memcpy(s.buffer.data() + s.pos, p, k);
+        s.pos = (s.pos + k) % s.buffer.size();
+        p += k;
+        n -= k;
+    }
+}
+
+void BM_WriteElementwise(benchmark::State& state) {
+    const auto v     = make_values();
+    sink       s;
+    auto       write = &write_bytes;
+    benchmark::DoNotOptimize(write);
+    for (auto _ : state) {
+        for (const float& x : v)
+            write(s, &x, sizeof(x));
+        benchmark::DoNotOptimize(s.buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(float)));
+}
+
+void BM_WriteChunked(benchmark::State& state) {
+    const auto v     = make_values();
+    sink       s;
+    auto       write = &write_bytes;
+    benchmark::DoNotOptimize(write);
+    for (auto _ : state) {
+        for (std::span<const float> chunk : bii::chunks(v, state.range(0)))
+            write(s, chunk.data(), chunk.size_bytes());
+        benchmark::DoNotOptimize(s.buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(float)));
+}
+
+} // namespace
+
+BENCHMARK(BM_SumElementwise);
+BENCHMARK(BM_SumChunked)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_WriteElementwise);
+BENCHMARK(BM_WriteChunked)->RangeMultiplier(8)->Range(64, 4096);
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/compile_time.bench.cpp -*-C++-*-
+
+// Compile-time benchmark, driven by compile_time.cmake.  Defines
+// BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES distinct random access iterator
+// types on the base selected by BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_BASE
+// (crtp_base, compat_base or deducing_base) and uses every operator
+// iterator_interface synthesizes on each of them.  Only meant to be compiled
+// with -fsyntax-only.
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/detail/stl_interfaces/iterator_interface.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#ifndef BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_BASE
+    #define BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_BASE compat_base
+#endif
+#ifndef BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES
+    #define BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES 100
+#endif
+
+namespace {
+
+namespace bii  = beman::iterator_interface;
+namespace crtp = beman::iterator_interface::detail::stl_interfaces::v2;
+
+struct crtp_base {
+    template <class D>
+    using type = crtp::iterator_interface<D, std::random_access_iterator_tag, int>;
+};
+
+struct compat_base {
+    template <class D>
+    using type = bii::ext_iterator_interface_compat<D, std::random_access_iterator_tag, int>;
+};
+
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+struct deducing_base {
+    template <class D>
+    using type = bii::iterator_interface<std::random_access_iterator_tag, int>;
+};
+#endif
+
+template <class Base, std::size_t I>
+class iterator : public Base::template type<iterator<Base, I>> {
+  public:
+    constexpr iterator() = default;
+    constexpr explicit iterator(int* p) : p_(p) {}
+
+  private:
+    friend bii::iterator_interface_access;
+    constexpr int*& base_reference() noexcept { return p_; }
+    constexpr int*  base_reference() const noexcept { return p_; }
+
+    int* p_ = nullptr;
+};
+
+template <class It>
+constexpr int use_operators() {
+    int a[] = {0, 1, 2, 3};
+    It  first(a);
+    It  last(a + 4);
+    It  it = first;
+    ++it;
+    it++;
+    --it;
+    it--;
+    it += 2;
+    it -= 1;
+    int result = *it + it[1] + static_cast<int>(last - first) + *(first + 1) + *(1 + first) + *(last - 1);
+    result += (first == last) + (first != last) + (first < last) + (first <= last) + (first > last) +
+              (first >= last) + ((first <=> last) < 0);
+    return result;
+}
+
+template <class Base, std::size_t... Is>
+constexpr int use_all(std::index_sequence<Is...>) {
+    static_assert((std::random_access_iterator<iterator<Base, Is>> && ...));
+    return (0 + ... + use_operators<iterator<Base, Is>>());
+}
+
+static_assert(use_all<BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_BASE>(
+                  std::make_index_sequence<BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES>()) ==
+              16 * BEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES);
+
+} // namespace
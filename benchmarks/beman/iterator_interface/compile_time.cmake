@@ -0,0 +1,51 @@
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+# cmake-format: off
+# benchmarks/beman/iterator_interface/compile_time.cmake -*-cmake-*-
+# cmake-format: on
+
+# Compile-time benchmark driver.  Compiles SOURCE with -fsyntax-only once per
+# base in BASES and type count in TYPES, and reports the front-end time and,
+# for GCC, the memory reported by -ftime-report.
+#
+# Usage: cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DINCLUDE_DIRECTORIES=<dirs>
+#              -DSOURCE=<compile_time.bench.cpp> -DBASES=<bases> -DTYPES=<counts>
+#              -P compile_time.cmake
+
+foreach(var IN ITEMS COMPILER SOURCE BASES TYPES)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+separate_arguments(FLAGS)
+set(includes "")
+foreach(dir IN LISTS INCLUDE_DIRECTORIES)
+    list(APPEND includes "-I${dir}")
+endforeach()
+
+foreach(base IN LISTS BASES)
+    foreach(types IN LISTS TYPES)
+        string(TIMESTAMP start "%s%f" UTC)
+        execute_process(
+            COMMAND
+                ${COMPILER} ${FLAGS} ${includes} -fsyntax-only -ftime-report
+                -DBEMAN_ITERATOR_INTERFACE_COMPILE_TIME_BASE=${base}_base
+                -DBEMAN_ITERATOR_INTERFACE_COMPILE_TIME_TYPES=${types} ${SOURCE}
+            RESULT_VARIABLE result
+            OUTPUT_VARIABLE output
+            ERROR_VARIABLE output
+        )
+        string(TIMESTAMP stop "%s%f" UTC)
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "${base} with ${types} types failed to compile:\n${output}")
+        endif()
+        math(EXPR wall "(${stop} - ${start}) / 1000")
+
+        # GCC: " TOTAL  :   0.52   0.08   0.61   87M"
+        set(memory "n/a")
+        if(output MATCHES "\n TOTAL[ \t]*:[^\n]*[ \t]([0-9]+[kMG]?)[ \t]*\n")
+            set(memory "${CMAKE_MATCH_1}")
+        endif()
+        message(STATUS "${base}: ${types} types, ${wall} ms, ${memory} memory")
+    endforeach()
+endforeach()
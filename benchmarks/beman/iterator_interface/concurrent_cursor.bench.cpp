@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/concurrent_cursor.bench.cpp -*-C++-*-
+
+// state.range(0) threads consuming 4M ints through one concurrent_cursor,
+// with guided chunks, and with fixed chunks of 1 (one fetch_add per element,
+// the worst case for contention) and 4096 elements.  The work per element
+// varies, so that fixed large chunks also show load imbalance.
+
+#include <beman/iterator_interface/concurrent_cursor.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 22;
+
+std::vector<unsigned> random_work() {
+    std::mt19937                            gen(42);
+    std::uniform_int_distribution<unsigned> dist(0, 15);
+    std::vector<unsigned>                   v(static_cast<std::size_t>(size));
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    return v;
+}
+
+// A small, data-dependent amount of work.
+unsigned process(unsigned x) {
+    unsigned h = x;
+    for (unsigned i = 0; i != x; ++i)
+        h = h * 2654435761u + i;
+    return h;
+}
+
+template <class Claim>
+void run(benchmark::State& state, Claim claim) {
+    const auto v       = random_work();
+    const int  threads = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        bii::concurrent_cursor cursor(v.begin(), v.end(), threads);
+        std::atomic<unsigned>  result{0};
+        auto                   work = [&] {
+            unsigned h = 0;
+            for (auto chunk = claim(cursor); !chunk.empty(); chunk = claim(cursor)) {
+                for (unsigned x : chunk)
+                    h += process(x);
+            }
+            result.fetch_add(h, std::memory_order_relaxed);
+        };
+        std::vector<std::thread> workers;
+        for (int t = 1; t < threads; ++t)
+            workers.emplace_back(work);
+        work();
+        for (auto& worker : workers)
+            worker.join();
+        benchmark::DoNotOptimize(result.load());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+void BM_CursorGuided(benchmark::State& state) {
+    run(state, [](auto& cursor) { return cursor.claim(); });
+}
+
+void BM_CursorFixed1(benchmark::State& state) {
+    run(state, [](auto& cursor) { return cursor.claim(1); });
+}
+
+void BM_CursorFixed4096(benchmark::State& state) {
+    run(state, [](auto& cursor) { return cursor.claim(4096); });
+}
+
+} // namespace
+
+BENCHMARK(BM_CursorGuided)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+BENCHMARK(BM_CursorFixed1)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+BENCHMARK(BM_CursorFixed4096)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/cyclic_iterator.bench.cpp -*-C++-*-
+
+// Tiling a pattern of state.range(0) chars into a 1 MiB buffer: the
+// examples' repeated_chars_iterator (one division per dereference), then
+// cyclic_iterator through std::copy (element by element, no division) and
+// through beman::iterator_interface::algorithms::copy (read_n, whole periods
+// at a time).
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/cyclic_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 20;
+
+class repeated_chars_iterator
+    : public bii::ext_iterator_interface_compat<repeated_chars_iterator, std::random_access_iterator_tag, char, char> {
+  public:
+    repeated_chars_iterator() = default;
+    repeated_chars_iterator(const char* first, difference_type size, difference_type n)
+        : first_(first), size_(size), n_(n) {}
+
+    char                     operator*() const { return first_[n_ % size_]; }
+    repeated_chars_iterator& operator+=(difference_type i) {
+        n_ += i;
+        return *this;
+    }
+    difference_type operator-(const repeated_chars_iterator& other) const { return n_ - other.n_; }
+
+  private:
+    const char*     first_ = nullptr;
+    difference_type size_  = 0;
+    difference_type n_     = 0;
+};
+
+std::string pattern(std::ptrdiff_t n) {
+    std::string s(static_cast<std::size_t>(n), '\0');
+    for (std::size_t i = 0; i < s.size(); ++i)
+        s[i] = static_cast<char>('a' + i % 26);
+    return s;
+}
+
+void BM_TileModulo(benchmark::State& state) {
+    const auto        p = pattern(state.range(0));
+    std::vector<char> out(static_cast<std::size_t>(size));
+    for (auto _ : state) {
+        const repeated_chars_iterator first(p.data(), state.range(0), 0);
+        benchmark::DoNotOptimize(std::copy(first, first + size, out.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+void BM_TileCyclicStdCopy(benchmark::State& state) {
+    const auto        p = pattern(state.range(0));
+    std::vector<char> out(static_cast<std::size_t>(size));
+    for (auto _ : state) {
+        const bii::cyclic_iterator<const char> first(p.data(), state.range(0));
+        benchmark::DoNotOptimize(std::copy(first, first + size, out.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+void BM_TileCyclicCopy(benchmark::State& state) {
+    const auto        p = pattern(state.range(0));
+    std::vector<char> out(static_cast<std::size_t>(size));
+    for (auto _ : state) {
+        const bii::cyclic_iterator<const char> first(p.data(), state.range(0));
+        benchmark::DoNotOptimize(bii::algorithms::copy(first, first + size, out.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+} // namespace
+
+BENCHMARK(BM_TileModulo)->Arg(3)->Arg(61)->Arg(4096);
+BENCHMARK(BM_TileCyclicStdCopy)->Arg(3)->Arg(61)->Arg(4096);
+BENCHMARK(BM_TileCyclicCopy)->Arg(3)->Arg(61)->Arg(4096);
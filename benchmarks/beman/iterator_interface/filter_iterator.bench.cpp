@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/filter_iterator.bench.cpp -*-C++-*-
+
+// filter_view iteration over 1M ints where one element in state.range(0)
+// passes the filter, compared to the examples' filtered_int_iterator pattern
+// (std::find_if on every increment, end and predicate stored in the
+// iterator).  The block search path is taken with value_predicate.
+
+#include <beman/iterator_interface/filter_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 20;
+
+std::vector<int> sparse_zeros(std::ptrdiff_t one_in) {
+    std::mt19937                       gen(42);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(one_in) - 1);
+    std::vector<int>                   v(static_cast<std::size_t>(size));
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    return v;
+}
+
+template <class Pred>
+class find_if_iterator {
+  public:
+    using iterator_concept  = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = int;
+    using reference         = const int&;
+    using pointer           = const int*;
+    using difference_type   = std::ptrdiff_t;
+
+    find_if_iterator() = default;
+    find_if_iterator(const int* it, const int* last, Pred pred)
+        : it_(std::find_if(it, last, pred)), last_(last), pred_(pred) {}
+
+    const int& operator*() const { return *it_; }
+
+    find_if_iterator& operator++() {
+        it_ = std::find_if(std::next(it_), last_, pred_);
+        return *this;
+    }
+    find_if_iterator operator++(int) {
+        auto retval = *this;
+        ++*this;
+        return retval;
+    }
+
+    friend bool operator==(const find_if_iterator& lhs, const find_if_iterator& rhs) { return lhs.it_ == rhs.it_; }
+
+  private:
+    const int* it_   = nullptr;
+    const int* last_ = nullptr;
+    Pred       pred_{};
+};
+
+constexpr auto is_zero = [](int i) { return i == 0; };
+
+void BM_FilterHandRolled(benchmark::State& state) {
+    const auto v = sparse_zeros(state.range(0));
+    for (auto _ : state) {
+        const find_if_iterator first(v.data(), v.data() + v.size(), is_zero);
+        const find_if_iterator last(v.data() + v.size(), v.data() + v.size(), is_zero);
+        benchmark::DoNotOptimize(std::distance(first, last));
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <class Pred>
+void BM_FilterView(benchmark::State& state, Pred pred) {
+    const auto v = sparse_zeros(state.range(0));
+    for (auto _ : state) {
+        const bii::filter_view view(v.data(), v.data() + v.size(), pred);
+        benchmark::DoNotOptimize(std::distance(view.begin(), view.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+void BM_FilterViewLambda(benchmark::State& state) { BM_FilterView(state, is_zero); }
+
+void BM_FilterViewBlockSearch(benchmark::State& state) {
+    BM_FilterView(state, bii::value_predicate(std::equal_to<>(), 0));
+}
+
+} // namespace
+
+BENCHMARK(BM_FilterHandRolled)->RangeMultiplier(8)->Range(4, 4096);
+BENCHMARK(BM_FilterViewLambda)->RangeMultiplier(8)->Range(4, 4096);
+BENCHMARK(BM_FilterViewBlockSearch)->RangeMultiplier(8)->Range(4, 4096);
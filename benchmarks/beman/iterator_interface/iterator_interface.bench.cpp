@@ -0,0 +1,578 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/iterator_interface.bench.cpp -*-C++-*-
+
+// Runtime cost of iterators built on iterator_interface compared to
+// hand-written equivalents.  Each iterator shape is instantiated on the CRTP
+// detail::stl_interfaces::v2::iterator_interface, on the deducing-this
+// iterator_interface (when BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS() is
+// enabled) and written out by hand; the hand-written iterators declare the
+// same iterator categories as iterator_interface would deduce, so that the
+// standard algorithms take the same code paths for all three.
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/detail/stl_interfaces/iterator_interface.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+namespace bii  = beman::iterator_interface;
+namespace crtp = beman::iterator_interface::detail::stl_interfaces::v2;
+
+// Base class selectors, so that each shape is written once for both
+// implementations of iterator_interface.
+template <class IteratorConcept, class ValueType, class Reference = ValueType&>
+struct crtp_base {
+    template <class D>
+    using type = crtp::iterator_interface<D, IteratorConcept, ValueType, Reference>;
+};
+
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+template <class IteratorConcept, class ValueType, class Reference = ValueType&>
+struct deducing_base {
+    template <class D>
+    using type = bii::iterator_interface<IteratorConcept, ValueType, Reference>;
+};
+#endif
+
+std::vector<int> random_ints(std::ptrdiff_t n) {
+    std::mt19937                       gen(42);
+    std::uniform_int_distribution<int> dist(0, 1 << 20);
+    std::vector<int>                   v(static_cast<std::size_t>(n));
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    return v;
+}
+
+// repeated_chars_iterator
+
+template <class Base>
+class repeated_chars_iterator : public Base::template type<repeated_chars_iterator<Base>> {
+  public:
+    repeated_chars_iterator() = default;
+    repeated_chars_iterator(const char* first, std::ptrdiff_t size, std::ptrdiff_t n)
+        : first_(first), size_(size), n_(n) {}
+
+    char                     operator*() const { return first_[n_ % size_]; }
+    repeated_chars_iterator& operator+=(std::ptrdiff_t i) {
+        n_ += i;
+        return *this;
+    }
+    std::ptrdiff_t operator-(repeated_chars_iterator other) const { return n_ - other.n_; }
+
+  private:
+    const char*    first_ = nullptr;
+    std::ptrdiff_t size_  = 0;
+    std::ptrdiff_t n_     = 0;
+};
+
+class hand_rolled_repeated_chars_iterator {
+  public:
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = char;
+    using reference         = char;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+
+    hand_rolled_repeated_chars_iterator() = default;
+    hand_rolled_repeated_chars_iterator(const char* first, difference_type size, difference_type n)
+        : first_(first), size_(size), n_(n) {}
+
+    char operator*() const { return first_[n_ % size_]; }
+    char operator[](difference_type i) const { return first_[(n_ + i) % size_]; }
+
+    hand_rolled_repeated_chars_iterator& operator++() {
+        ++n_;
+        return *this;
+    }
+    hand_rolled_repeated_chars_iterator operator++(int) {
+        auto retval = *this;
+        ++n_;
+        return retval;
+    }
+    hand_rolled_repeated_chars_iterator& operator--() {
+        --n_;
+        return *this;
+    }
+    hand_rolled_repeated_chars_iterator operator--(int) {
+        auto retval = *this;
+        --n_;
+        return retval;
+    }
+    hand_rolled_repeated_chars_iterator& operator+=(difference_type i) {
+        n_ += i;
+        return *this;
+    }
+    hand_rolled_repeated_chars_iterator& operator-=(difference_type i) {
+        n_ -= i;
+        return *this;
+    }
+
+    friend hand_rolled_repeated_chars_iterator operator+(hand_rolled_repeated_chars_iterator it, difference_type i) {
+        return it += i;
+    }
+    friend hand_rolled_repeated_chars_iterator operator+(difference_type i, hand_rolled_repeated_chars_iterator it) {
+        return it += i;
+    }
+    friend hand_rolled_repeated_chars_iterator operator-(hand_rolled_repeated_chars_iterator it, difference_type i) {
+        return it -= i;
+    }
+    friend difference_type operator-(const hand_rolled_repeated_chars_iterator& lhs,
+                                     const hand_rolled_repeated_chars_iterator& rhs) {
+        return lhs.n_ - rhs.n_;
+    }
+    friend bool operator==(const hand_rolled_repeated_chars_iterator& lhs,
+                           const hand_rolled_repeated_chars_iterator& rhs) {
+        return lhs.n_ == rhs.n_;
+    }
+    friend std::strong_ordering operator<=>(const hand_rolled_repeated_chars_iterator& lhs,
+                                            const hand_rolled_repeated_chars_iterator& rhs) {
+        return lhs.n_ <=> rhs.n_;
+    }
+
+  private:
+    const char*     first_ = nullptr;
+    difference_type size_  = 0;
+    difference_type n_     = 0;
+};
+
+using repeated_chars_crtp = repeated_chars_iterator<crtp_base<std::random_access_iterator_tag, char, char>>;
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+using repeated_chars_deducing = repeated_chars_iterator<deducing_base<std::random_access_iterator_tag, char, char>>;
+#endif
+using repeated_chars_hand_rolled = hand_rolled_repeated_chars_iterator;
+
+constexpr std::string_view pattern = "abcdefghijklmnopqrstuvwxyz";
+
+template <class It>
+std::pair<It, It> repeated_chars_range(std::ptrdiff_t n) {
+    const auto size = static_cast<std::ptrdiff_t>(pattern.size());
+    return {It(pattern.data(), size, 0), It(pattern.data(), size, n)};
+}
+
+template <class It>
+void BM_RepeatedCharsCopy(benchmark::State& state) {
+    std::vector<char> out(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto [first, last] = repeated_chars_range<It>(state.range(0));
+        benchmark::DoNotOptimize(first);
+        std::copy(first, last, out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_RepeatedCharsFind(benchmark::State& state) {
+    for (auto _ : state) {
+        auto [first, last] = repeated_chars_range<It>(state.range(0));
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(std::find(first, last, '#'));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_RepeatedCharsAccumulate(benchmark::State& state) {
+    for (auto _ : state) {
+        auto [first, last] = repeated_chars_range<It>(state.range(0));
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(std::accumulate(first, last, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The reference type is a prvalue, so iterator_category is
+// input_iterator_tag and std::distance() is linear for all three variants.
+template <class It>
+void BM_RepeatedCharsDistance(benchmark::State& state) {
+    for (auto _ : state) {
+        auto [first, last] = repeated_chars_range<It>(state.range(0));
+        benchmark::DoNotOptimize(first);
+        benchmark::DoNotOptimize(std::distance(first, last));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// filtered_int_iterator
+
+struct is_even {
+    bool operator()(int i) const { return (i % 2) == 0; }
+};
+
+template <class Base>
+class filtered_int_iterator : public Base::template type<filtered_int_iterator<Base>> {
+  public:
+    filtered_int_iterator() = default;
+    filtered_int_iterator(int* it, int* last) : it_(std::find_if(it, last, is_even{})), last_(last) {}
+
+    filtered_int_iterator& operator++() {
+        it_ = std::find_if(std::next(it_), last_, is_even{});
+        return *this;
+    }
+
+  private:
+    friend bii::iterator_interface_access;
+    int*& base_reference() noexcept { return it_; }
+    int*  base_reference() const noexcept { return it_; }
+
+    int* it_   = nullptr;
+    int* last_ = nullptr;
+};
+
+class hand_rolled_filtered_int_iterator {
+  public:
+    using iterator_concept  = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = int;
+    using reference         = int&;
+    using pointer           = int*;
+    using difference_type   = std::ptrdiff_t;
+
+    hand_rolled_filtered_int_iterator() = default;
+    hand_rolled_filtered_int_iterator(int* it, int* last) : it_(std::find_if(it, last, is_even{})), last_(last) {}
+
+    int& operator*() const { return *it_; }
+    int* operator->() const { return it_; }
+
+    hand_rolled_filtered_int_iterator& operator++() {
+        it_ = std::find_if(std::next(it_), last_, is_even{});
+        return *this;
+    }
+    hand_rolled_filtered_int_iterator operator++(int) {
+        auto retval = *this;
+        ++*this;
+        return retval;
+    }
+
+    friend bool operator==(const hand_rolled_filtered_int_iterator& lhs, const hand_rolled_filtered_int_iterator& rhs) {
+        return lhs.it_ == rhs.it_;
+    }
+
+  private:
+    int* it_   = nullptr;
+    int* last_ = nullptr;
+};
+
+using filtered_int_crtp = filtered_int_iterator<crtp_base<std::forward_iterator_tag, int>>;
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+using filtered_int_deducing = filtered_int_iterator<deducing_base<std::forward_iterator_tag, int>>;
+#endif
+using filtered_int_hand_rolled = hand_rolled_filtered_int_iterator;
+
+template <class It>
+void BM_FilteredIntCopy(benchmark::State& state) {
+    auto             v = random_ints(state.range(0));
+    std::vector<int> out(v.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        std::copy(It(v.data(), v.data() + v.size()), It(v.data() + v.size(), v.data() + v.size()), out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_FilteredIntFind(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(
+            std::find(It(v.data(), v.data() + v.size()), It(v.data() + v.size(), v.data() + v.size()), -2));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_FilteredIntAccumulate(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(
+            std::accumulate(It(v.data(), v.data() + v.size()), It(v.data() + v.size(), v.data() + v.size()), 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_FilteredIntDistance(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(
+            std::distance(It(v.data(), v.data() + v.size()), It(v.data() + v.size(), v.data() + v.size())));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// capturing_filter_iterator: filtered_int_iterator with its predicate, a
+// lambda that captures a vector, stored in the iterator.  Copying the
+// iterator allocates, so this measures whether it != last copies; the
+// by_value variant defines its own operator== taking iterators by value, as
+// the free operators of iterator_interface used to.
+
+inline auto make_capturing_pred() {
+    return [rejected = std::vector<int>{1, 3, 5, 7, 9}](int i) {
+        return std::find(rejected.begin(), rejected.end(), i % 10) == rejected.end();
+    };
+}
+
+using capturing_pred = decltype(make_capturing_pred());
+
+template <class Base, bool ByValue = false>
+class capturing_filter_iterator : public Base::template type<capturing_filter_iterator<Base, ByValue>> {
+  public:
+    capturing_filter_iterator(int* it, int* last)
+        : it_(std::find_if(it, last, make_capturing_pred())), last_(last), pred_(make_capturing_pred()) {}
+
+    capturing_filter_iterator& operator++() {
+        it_ = std::find_if(std::next(it_), last_, std::cref(pred_));
+        return *this;
+    }
+
+    friend bool operator==(capturing_filter_iterator lhs, capturing_filter_iterator rhs)
+        requires ByValue
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+  private:
+    friend bii::iterator_interface_access;
+    int*& base_reference() noexcept { return it_; }
+    int*  base_reference() const noexcept { return it_; }
+
+    int*           it_   = nullptr;
+    int*           last_ = nullptr;
+    capturing_pred pred_;
+};
+
+class hand_rolled_capturing_filter_iterator {
+  public:
+    using iterator_concept  = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = int;
+    using reference         = int&;
+    using pointer           = int*;
+    using difference_type   = std::ptrdiff_t;
+
+    hand_rolled_capturing_filter_iterator(int* it, int* last)
+        : it_(std::find_if(it, last, make_capturing_pred())), last_(last), pred_(make_capturing_pred()) {}
+
+    int& operator*() const { return *it_; }
+
+    hand_rolled_capturing_filter_iterator& operator++() {
+        it_ = std::find_if(std::next(it_), last_, std::cref(pred_));
+        return *this;
+    }
+
+    friend bool operator==(const hand_rolled_capturing_filter_iterator& lhs,
+                           const hand_rolled_capturing_filter_iterator& rhs) {
+        return lhs.it_ == rhs.it_;
+    }
+
+  private:
+    int*           it_   = nullptr;
+    int*           last_ = nullptr;
+    capturing_pred pred_;
+};
+
+using capturing_filter_crtp = capturing_filter_iterator<crtp_base<std::forward_iterator_tag, int>>;
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+using capturing_filter_deducing = capturing_filter_iterator<deducing_base<std::forward_iterator_tag, int>>;
+#endif
+using capturing_filter_hand_rolled = hand_rolled_capturing_filter_iterator;
+using capturing_filter_by_value    = capturing_filter_iterator<crtp_base<std::forward_iterator_tag, int>, true>;
+
+template <class It>
+void BM_CapturingFilterDistance(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(
+            std::distance(It(v.data(), v.data() + v.size()), It(v.data() + v.size(), v.data() + v.size())));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// pointer_iterator: a plain adaptor whose every operation comes from the
+// underlying int*.
+
+template <class Base>
+class pointer_iterator : public Base::template type<pointer_iterator<Base>> {
+  public:
+    pointer_iterator() = default;
+    explicit pointer_iterator(int* p) : p_(p) {}
+
+  private:
+    friend bii::iterator_interface_access;
+    int*& base_reference() noexcept { return p_; }
+    int*  base_reference() const noexcept { return p_; }
+
+    int* p_ = nullptr;
+};
+
+class hand_rolled_pointer_iterator {
+  public:
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = int;
+    using reference         = int&;
+    using pointer           = int*;
+    using difference_type   = std::ptrdiff_t;
+
+    hand_rolled_pointer_iterator() = default;
+    explicit hand_rolled_pointer_iterator(int* p) : p_(p) {}
+
+    int& operator*() const { return *p_; }
+    int* operator->() const { return p_; }
+    int& operator[](difference_type n) const { return p_[n]; }
+
+    hand_rolled_pointer_iterator& operator++() {
+        ++p_;
+        return *this;
+    }
+    hand_rolled_pointer_iterator operator++(int) { return hand_rolled_pointer_iterator(p_++); }
+    hand_rolled_pointer_iterator& operator--() {
+        --p_;
+        return *this;
+    }
+    hand_rolled_pointer_iterator  operator--(int) { return hand_rolled_pointer_iterator(p_--); }
+    hand_rolled_pointer_iterator& operator+=(difference_type n) {
+        p_ += n;
+        return *this;
+    }
+    hand_rolled_pointer_iterator& operator-=(difference_type n) {
+        p_ -= n;
+        return *this;
+    }
+
+    friend hand_rolled_pointer_iterator operator+(hand_rolled_pointer_iterator it, difference_type n) {
+        return it += n;
+    }
+    friend hand_rolled_pointer_iterator operator+(difference_type n, hand_rolled_pointer_iterator it) {
+        return it += n;
+    }
+    friend hand_rolled_pointer_iterator operator-(hand_rolled_pointer_iterator it, difference_type n) {
+        return it -= n;
+    }
+    friend difference_type operator-(const hand_rolled_pointer_iterator& lhs, const hand_rolled_pointer_iterator& rhs) {
+        return lhs.p_ - rhs.p_;
+    }
+    friend bool operator==(const hand_rolled_pointer_iterator& lhs, const hand_rolled_pointer_iterator& rhs) {
+        return lhs.p_ == rhs.p_;
+    }
+    friend std::strong_ordering operator<=>(const hand_rolled_pointer_iterator& lhs,
+                                            const hand_rolled_pointer_iterator& rhs) {
+        return lhs.p_ <=> rhs.p_;
+    }
+
+  private:
+    int* p_ = nullptr;
+};
+
+using pointer_crtp = pointer_iterator<crtp_base<std::random_access_iterator_tag, int>>;
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+using pointer_deducing = pointer_iterator<deducing_base<std::random_access_iterator_tag, int>>;
+#endif
+using pointer_hand_rolled = hand_rolled_pointer_iterator;
+
+template <class It>
+void BM_PointerCopy(benchmark::State& state) {
+    auto             v = random_ints(state.range(0));
+    std::vector<int> out(v.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        std::copy(It(v.data()), It(v.data() + v.size()), It(out.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_PointerFind(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(std::find(It(v.data()), It(v.data() + v.size()), -1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_PointerAccumulate(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(std::accumulate(It(v.data()), It(v.data() + v.size()), 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Includes restoring the unsorted input on every iteration, identically for
+// all variants.
+template <class It>
+void BM_PointerSort(benchmark::State& state) {
+    const auto       v = random_ints(state.range(0));
+    std::vector<int> work(v.size());
+    for (auto _ : state) {
+        std::copy(v.begin(), v.end(), work.begin());
+        std::sort(It(work.data()), It(work.data() + work.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class It>
+void BM_PointerDistance(benchmark::State& state) {
+    auto v = random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(std::distance(It(v.data()), It(v.data() + v.size())));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+#define BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, iterator) \
+    BENCHMARK_TEMPLATE(bm, iterator)->RangeMultiplier(64)->Range(1 << 8, 1 << 20)
+
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+    #define BEMAN_ITERATOR_INTERFACE_BENCHMARK(bm, shape)                   \
+        BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, shape##_hand_rolled); \
+        BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, shape##_crtp);        \
+        BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, shape##_deducing)
+#else
+    #define BEMAN_ITERATOR_INTERFACE_BENCHMARK(bm, shape)                   \
+        BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, shape##_hand_rolled); \
+        BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(bm, shape##_crtp)
+#endif
+
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_RepeatedCharsCopy, repeated_chars);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_RepeatedCharsFind, repeated_chars);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_RepeatedCharsAccumulate, repeated_chars);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_RepeatedCharsDistance, repeated_chars);
+
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_FilteredIntCopy, filtered_int);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_FilteredIntFind, filtered_int);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_FilteredIntAccumulate, filtered_int);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_FilteredIntDistance, filtered_int);
+
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_CapturingFilterDistance, capturing_filter);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK_VARIANT(BM_CapturingFilterDistance, capturing_filter_by_value);
+
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_PointerCopy, pointer);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_PointerFind, pointer);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_PointerAccumulate, pointer);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_PointerSort, pointer);
+BEMAN_ITERATOR_INTERFACE_BENCHMARK(BM_PointerDistance, pointer);
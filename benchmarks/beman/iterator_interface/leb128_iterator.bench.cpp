@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/leb128_iterator.bench.cpp -*-C++-*-
+
+// Summing 16M LEB128-encoded 32-bit values: decoded one value at a time, one
+// byte at a time, as a plain decoder does, which is the baseline; through
+// leb128_view, which decodes blocks into a buffer; and with leb128_decode
+// into a buffer of the benchmark's, without the iterator.  state.range(0)
+// picks the values: 0 for the gaps of a dense posting list, nearly all one
+// byte long, 1 for values below 2^14, mostly two bytes long, and 2 for random
+// 32-bit values, mostly five bytes long.  The delta benchmarks decode sorted
+// ids from their gaps.
+
+#include <beman/iterator_interface/leb128_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::size_t size = std::size_t(1) << 24;
+
+std::vector<std::byte> make_bytes(std::int64_t kind) {
+    std::mt19937                          gen(42);
+    std::geometric_distribution<unsigned> gap(0.05);
+    std::vector<std::byte>                bytes;
+    for (std::size_t i = 0; i != size; ++i) {
+        const std::uint32_t value = kind == 0 ? gap(gen) : kind == 1 ? gen() >> 18 : static_cast<std::uint32_t>(gen());
+        bii::leb128_encode(value, std::back_inserter(bytes));
+    }
+    return bytes;
+}
+
+void BM_ScalarDecode(benchmark::State& state) {
+    const auto bytes = make_bytes(state.range(0));
+    for (auto _ : state) {
+        std::uint32_t    sum = 0;
+        const std::byte* p   = bytes.data();
+        const std::byte* q   = p + bytes.size();
+        while (p != q) {
+            std::uint32_t value = 0;
+            for (int shift = 0;; shift += 7) {
+                const auto b = static_cast<std::uint32_t>(*p++);
+                value |= (b & 0x7f) << shift;
+                if ((b & 0x80) == 0)
+                    break;
+            }
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_Leb128View(benchmark::State& state) {
+    const auto                      bytes = make_bytes(state.range(0));
+    bii::leb128_view<std::uint32_t> values(bytes);
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (std::uint32_t value : values)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_Leb128Decode(benchmark::State& state) {
+    const auto bytes = make_bytes(state.range(0));
+    for (auto _ : state) {
+        std::uint32_t                  sum = 0;
+        std::span<const std::byte>     rest(bytes);
+        std::array<std::uint32_t, 128> block;
+        while (const std::size_t n = bii::leb128_decode(rest, std::span(block)))
+            for (std::size_t i = 0; i != n; ++i)
+                sum += block[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_ScalarDecodeDelta(benchmark::State& state) {
+    const auto bytes = make_bytes(0);
+    for (auto _ : state) {
+        std::uint32_t    id  = 0;
+        std::uint32_t    sum = 0;
+        const std::byte* p   = bytes.data();
+        const std::byte* q   = p + bytes.size();
+        while (p != q) {
+            std::uint32_t value = 0;
+            for (int shift = 0;; shift += 7) {
+                const auto b = static_cast<std::uint32_t>(*p++);
+                value |= (b & 0x7f) << shift;
+                if ((b & 0x80) == 0)
+                    break;
+            }
+            id += value;
+            sum ^= id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_Leb128ViewDelta(benchmark::State& state) {
+    const auto                            bytes = make_bytes(0);
+    bii::leb128_view<std::uint32_t, true> ids(bytes);
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (std::uint32_t id : ids)
+            sum ^= id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+} // namespace
+
+BENCHMARK(BM_ScalarDecode)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK(BM_Leb128View)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK(BM_Leb128Decode)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK(BM_ScalarDecodeDelta);
+BENCHMARK(BM_Leb128ViewDelta);
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/line_iterator.bench.cpp -*-C++-*-
+
+// Counting the lines and bytes of a local log-like file, by default 512 MiB
+// (set BEMAN_ITERATOR_INTERFACE_BENCH_FILE_MIB to change it), whose lines are
+// on average state.range(0) bytes long: with std::getline, with an
+// std::istream_iterator over lines, with a memchr loop over the mapped file
+// for reference, and with line_iterator over the mapped file.
+
+#include <beman/iterator_interface/line_iterator.hpp>
+#include <beman/iterator_interface/mapped_file.hpp>
+
+#if BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE()
+
+    #include <benchmark/benchmark.h>
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstring>
+    #include <filesystem>
+    #include <fstream>
+    #include <iterator>
+    #include <map>
+    #include <memory>
+    #include <random>
+    #include <string>
+    #include <string_view>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+// The benchmark files, one per line length, written on first use and removed
+// at exit.
+class log_file {
+  public:
+    explicit log_file(std::ptrdiff_t line_length)
+        : path_(std::filesystem::temp_directory_path() /
+                ("beman_iterator_interface_lines_" + std::to_string(line_length) + ".log")) {
+        const char*                                   mib  = std::getenv("BEMAN_ITERATOR_INTERFACE_BENCH_FILE_MIB");
+        const std::size_t                             size = (mib ? std::stoull(mib) : 512) * (std::size_t(1) << 20);
+        std::mt19937                                  gen(42);
+        std::uniform_int_distribution<std::ptrdiff_t> length(0, 2 * line_length);
+        std::ofstream                                 out(path_, std::ios::binary);
+        std::string                                   line;
+        for (std::size_t written = 0; written < size; written += line.size()) {
+            line.assign(static_cast<std::size_t>(length(gen)), 'x');
+            line += '\n';
+            out << line;
+        }
+    }
+    ~log_file() { std::filesystem::remove(path_); }
+
+    static const log_file& get(std::ptrdiff_t line_length) {
+        static std::map<std::ptrdiff_t, std::unique_ptr<log_file>> files;
+        auto& file = files[line_length];
+        if (!file)
+            file = std::make_unique<log_file>(line_length);
+        return *file;
+    }
+
+    std::string path() const { return path_.string(); }
+    std::size_t size() const { return std::filesystem::file_size(path_); }
+
+  private:
+    std::filesystem::path path_;
+};
+
+struct totals {
+    std::size_t lines = 0;
+    std::size_t bytes = 0;
+
+    void add(std::string_view line) {
+        ++lines;
+        bytes += line.size();
+    }
+};
+
+void report(benchmark::State& state, const log_file& file, const totals& t) {
+    benchmark::DoNotOptimize(t.lines);
+    benchmark::DoNotOptimize(t.bytes);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file.size()));
+}
+
+void BM_Getline(benchmark::State& state) {
+    const log_file& file = log_file::get(state.range(0));
+    totals          t;
+    for (auto _ : state) {
+        std::ifstream in(file.path(), std::ios::binary);
+        t = totals();
+        for (std::string line; std::getline(in, line);)
+            t.add(line);
+    }
+    report(state, file, t);
+}
+
+struct line {
+    std::string text;
+
+    friend std::istream& operator>>(std::istream& in, line& l) { return std::getline(in, l.text); }
+};
+
+void BM_IstreamIterator(benchmark::State& state) {
+    const log_file& file = log_file::get(state.range(0));
+    totals          t;
+    for (auto _ : state) {
+        std::ifstream in(file.path(), std::ios::binary);
+        t = totals();
+        for (auto it = std::istream_iterator<line>(in); it != std::istream_iterator<line>(); ++it)
+            t.add(it->text);
+    }
+    report(state, file, t);
+}
+
+void BM_MappedMemchr(benchmark::State& state) {
+    const log_file& file = log_file::get(state.range(0));
+    totals          t;
+    for (auto _ : state) {
+        const bii::mapped_file m(file.path().c_str());
+        t             = totals();
+        const char* p = reinterpret_cast<const char*>(m.data());
+        const char* q = p + m.size();
+        while (p != q) {
+            const auto* eol = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(q - p)));
+            const char* end = eol ? eol : q;
+            t.add(std::string_view(p, static_cast<std::size_t>(end - p)));
+            p = eol ? eol + 1 : q;
+        }
+    }
+    report(state, file, t);
+}
+
+void BM_MappedLineIterator(benchmark::State& state) {
+    const log_file& file = log_file::get(state.range(0));
+    totals          t;
+    for (auto _ : state) {
+        const bii::mapped_file m(file.path().c_str());
+        t = totals();
+        for (std::string_view l : bii::lines(std::string_view(reinterpret_cast<const char*>(m.data()), m.size())))
+            t.add(l);
+    }
+    report(state, file, t);
+}
+
+} // namespace
+
+BENCHMARK(BM_Getline)->Arg(16)->Arg(80)->Arg(400)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IstreamIterator)->Arg(16)->Arg(80)->Arg(400)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedMemchr)->Arg(16)->Arg(80)->Arg(400)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedLineIterator)->Arg(16)->Arg(80)->Arg(400)->Unit(benchmark::kMillisecond);
+
+#endif
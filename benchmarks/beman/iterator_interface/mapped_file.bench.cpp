@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/mapped_file.bench.cpp -*-C++-*-
+
+// Summing a field of every 64-byte record of a local file, by default 2 GiB
+// (set BEMAN_ITERATOR_INTERFACE_BENCH_FILE_MIB to change it): read() into a
+// 1 MiB buffer and iterating over it, against iterating over mapped_records.
+// With state.range(0) = 1 the file is evicted from the page cache before each
+// iteration (posix_fadvise(POSIX_FADV_DONTNEED)), so that it is read from disk.
+
+#include <beman/iterator_interface/mapped_file.hpp>
+
+#if BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE()
+
+    #include <benchmark/benchmark.h>
+
+    #include <algorithm>
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <filesystem>
+    #include <fstream>
+    #include <string>
+    #include <vector>
+
+    #include <fcntl.h>
+    #include <unistd.h>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+struct record {
+    std::uint64_t key;
+    std::uint64_t value;
+    std::uint64_t payload[6];
+};
+
+// The benchmark file, written on first use and removed at exit.
+class record_file {
+  public:
+    record_file() : path_(std::filesystem::temp_directory_path() / "beman_iterator_interface_records.bin") {
+        const char*         mib = std::getenv("BEMAN_ITERATOR_INTERFACE_BENCH_FILE_MIB");
+        const std::size_t   n   = (mib ? std::stoull(mib) : 2048) * (std::size_t(1) << 20) / sizeof(record);
+        std::ofstream       out(path_, std::ios::binary);
+        std::vector<record> block(std::size_t(1) << 14);
+        for (std::size_t i = 0; i < n; i += block.size()) {
+            const std::size_t k = std::min(block.size(), n - i);
+            for (std::size_t j = 0; j != k; ++j)
+                block[j] = record{i + j, (i + j) % 7, {}};
+            out.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(k * sizeof(record)));
+        }
+        records_ = n;
+    }
+    ~record_file() { std::filesystem::remove(path_); }
+
+    static const record_file& get() {
+        static const record_file file;
+        return file;
+    }
+
+    std::string path() const { return path_.string(); }
+    std::size_t records() const { return records_; }
+
+    void evict() const {
+        const int fd = ::open(path_.c_str(), O_RDONLY);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+
+  private:
+    std::filesystem::path path_;
+    std::size_t           records_ = 0;
+};
+
+void prepare(benchmark::State& state, const record_file& file) {
+    if (state.range(0)) {
+        state.PauseTiming();
+        file.evict();
+        state.ResumeTiming();
+    }
+}
+
+void set_processed(benchmark::State& state, const record_file& file) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file.records() * sizeof(record)));
+}
+
+void BM_ReadIntoBuffer(benchmark::State& state) {
+    const record_file&  file = record_file::get();
+    std::vector<record> buffer((std::size_t(1) << 20) / sizeof(record));
+    for (auto _ : state) {
+        prepare(state, file);
+        const int     fd  = ::open(file.path().c_str(), O_RDONLY);
+        std::uint64_t sum = 0;
+        for (;;) {
+            const ::ssize_t n = ::read(fd, buffer.data(), buffer.size() * sizeof(record));
+            if (n <= 0)
+                break;
+            for (std::size_t i = 0, k = static_cast<std::size_t>(n) / sizeof(record); i != k; ++i)
+                sum += buffer[i].value;
+        }
+        ::close(fd);
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, file);
+}
+
+void BM_MappedRecords(benchmark::State& state) {
+    const record_file& file = record_file::get();
+    for (auto _ : state) {
+        prepare(state, file);
+        const bii::mapped_records<record> records(file.path().c_str());
+        std::uint64_t                     sum = 0;
+        for (const record& r : records)
+            sum += r.value;
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, file);
+}
+
+// Backwards, where the kernel's readahead does not help and the iterator's
+// MADV_WILLNEED hints do.
+void BM_MappedRecordsReverse(benchmark::State& state) {
+    const record_file& file = record_file::get();
+    for (auto _ : state) {
+        prepare(state, file);
+        const bii::mapped_records<record> records(file.path().c_str());
+        std::uint64_t                     sum = 0;
+        for (auto it = records.end(); it != records.begin();)
+            sum += (--it)->value;
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, file);
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadIntoBuffer)->ArgName("cold")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_MappedRecords)->ArgName("cold")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_MappedRecordsReverse)->ArgName("cold")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#endif
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/merge_iterator.bench.cpp -*-C++-*-
+
+// Merging state.range(0) sorted runs holding 1M 64-bit keys in total into a
+// vector: a std::priority_queue of (key, run) pairs, then merge_iterator
+// through std::copy (one increment per element) and through
+// beman::iterator_interface::algorithms::copy (read_n, draining runs while
+// they stay the minimum).  With state.range(1) = 0 the keys are uniformly
+// random, so the runs interleave element by element; with 1 each run is made
+// of blocks of 256 consecutive keys, as in time-ordered log segments.
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/merge_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::size_t size  = std::size_t(1) << 20;
+constexpr std::size_t block = 256;
+
+std::vector<std::vector<std::uint64_t>> make_runs(std::size_t k, bool blocks) {
+    std::mt19937_64                         gen(42);
+    std::vector<std::vector<std::uint64_t>> runs(k);
+    for (std::size_t i = 0; i != size;) {
+        auto& run = runs[gen() % k];
+        if (blocks) {
+            const std::uint64_t first = gen() >> 16;
+            for (std::size_t j = 0; j != block; ++j, ++i)
+                run.push_back(first + j);
+        } else {
+            run.push_back(gen());
+            ++i;
+        }
+    }
+    for (auto& run : runs)
+        std::sort(run.begin(), run.end());
+    return runs;
+}
+
+void BM_MergeHeap(benchmark::State& state) {
+    const auto                 runs = make_runs(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+    std::vector<std::uint64_t> out(size);
+    using entry = std::pair<std::uint64_t, std::size_t>;
+    for (auto _ : state) {
+        std::vector<std::size_t> pos(runs.size());
+        std::priority_queue<entry, std::vector<entry>, std::greater<>> heap;
+        for (std::size_t i = 0; i != runs.size(); ++i) {
+            if (!runs[i].empty())
+                heap.emplace(runs[i][0], i);
+        }
+        auto o = out.begin();
+        while (!heap.empty()) {
+            const auto [key, i] = heap.top();
+            heap.pop();
+            *o++ = key;
+            if (++pos[i] != runs[i].size())
+                heap.emplace(runs[i][pos[i]], i);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_MergeLoserTree(benchmark::State& state) {
+    const auto                 runs = make_runs(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+    std::vector<std::uint64_t> out(size);
+    for (auto _ : state) {
+        const auto merged = bii::merge_runs(runs);
+        benchmark::DoNotOptimize(std::copy(merged.begin(), merged.end(), out.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_MergeLoserTreeCopy(benchmark::State& state) {
+    const auto                 runs = make_runs(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+    std::vector<std::uint64_t> out(size);
+    for (auto _ : state) {
+        const auto merged = bii::merge_runs(runs);
+        benchmark::DoNotOptimize(bii::algorithms::copy(merged.begin(), merged.end(), out.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+} // namespace
+
+BENCHMARK(BM_MergeHeap)->ArgsProduct({{2, 8, 32, 128, 512, 1024}, {0, 1}});
+BENCHMARK(BM_MergeLoserTree)->ArgsProduct({{2, 8, 32, 128, 512, 1024}, {0, 1}});
+BENCHMARK(BM_MergeLoserTreeCopy)->ArgsProduct({{2, 8, 32, 128, 512, 1024}, {0, 1}});
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/partition.bench.cpp -*-C++-*-
+
+// Parallel reduction over 4M ints with state.range(0) threads, each summing
+// one part from partition_range(): the ints themselves (cut with
+// operator-/+=), and a filter_view keeping one in four of them (cut by the
+// split hook of filter_iterator, which does not scan the range).  Only scales
+// on a machine with as many cores as threads.
+
+#include <beman/iterator_interface/filter_iterator.hpp>
+#include <beman/iterator_interface/partition.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 22;
+
+std::vector<int> random_ints() {
+    std::mt19937                       gen(42);
+    std::uniform_int_distribution<int> dist(0, 1 << 10);
+    std::vector<int>                   v(static_cast<std::size_t>(size));
+    std::generate(v.begin(), v.end(), [&] { return dist(gen); });
+    return v;
+}
+
+struct is_multiple_of_4 {
+    bool operator()(int i) const { return i % 4 == 0; }
+};
+
+template <class It>
+long long parallel_sum(It first, It last, int threads) {
+    const auto               parts = bii::algorithms::partition_range(first, last, threads);
+    std::vector<long long>   sums(parts.size());
+    std::vector<std::thread> workers;
+    workers.reserve(parts.size() - 1);
+    for (std::size_t i = 1; i < parts.size(); ++i)
+        workers.emplace_back([&sums, &parts, i] { sums[i] = std::accumulate(parts[i].begin(), parts[i].end(), 0LL); });
+    sums[0] = std::accumulate(parts[0].begin(), parts[0].end(), 0LL);
+    for (auto& worker : workers)
+        worker.join();
+    return std::accumulate(sums.begin(), sums.end(), 0LL);
+}
+
+void BM_ParallelReduce(benchmark::State& state) {
+    const auto v = random_ints();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parallel_sum(v.begin(), v.end(), static_cast<int>(state.range(0))));
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+void BM_ParallelReduceFilter(benchmark::State& state) {
+    const auto             v = random_ints();
+    const bii::filter_view view(v.data(), v.data() + v.size(), is_multiple_of_4{});
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parallel_sum(view.begin(), view.end(), static_cast<int>(state.range(0))));
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+} // namespace
+
+BENCHMARK(BM_ParallelReduce)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_ParallelReduceFilter)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
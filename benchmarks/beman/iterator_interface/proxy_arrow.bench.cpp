@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/proxy_arrow.bench.cpp -*-C++-*-
+
+// Summing it->get() over 64K elements through proxy iterators, with
+// proxy_arrow_result (the proxy is constructed in place by operator->) and
+// with a pointer type that can only take the proxy by move.  The proxies are
+// a pair of references (trivially copyable) and one holding a shared_ptr to
+// its storage (every move is a reference count update).  Each iterator is
+// instantiated on the CRTP detail::stl_interfaces::v2::iterator_interface and,
+// when BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS() is enabled, on the
+// deducing-this iterator_interface, each with its own proxy_arrow_result, so
+// that one run compares both.
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/detail/stl_interfaces/iterator_interface.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace bii  = beman::iterator_interface;
+namespace crtp = beman::iterator_interface::detail::stl_interfaces;
+
+// Base class selectors, as in iterator_interface.bench.cpp.
+struct crtp_base {
+    template <class D, class Reference, class Pointer>
+    using type = crtp::v2::iterator_interface<D, std::random_access_iterator_tag, int, Reference, Pointer>;
+
+    template <class T>
+    using arrow = crtp::proxy_arrow_result<T>;
+};
+
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+struct deducing_base {
+    template <class D, class Reference, class Pointer>
+    using type = bii::iterator_interface<std::random_access_iterator_tag, int, Reference, Pointer>;
+
+    template <class T>
+    using arrow = bii::proxy_arrow_result<T>;
+};
+#endif
+
+constexpr std::ptrdiff_t size = 1 << 16;
+
+struct storage {
+    std::vector<int> keys;
+    std::vector<int> values;
+};
+
+// The pointer type of operator-> before in-place construction was available.
+template <class T>
+class moving_arrow_result {
+  public:
+    moving_arrow_result(T&& value) : value_(std::move(value)) {}
+
+    const T* operator->() const noexcept { return &value_; }
+
+  private:
+    T value_;
+};
+
+struct ref_pair {
+    int& key;
+    int& value;
+
+    int get() const noexcept { return key + value; }
+    operator int() const noexcept { return get(); }
+};
+
+struct shared_ref {
+    std::shared_ptr<storage> owner;
+    std::ptrdiff_t           i;
+
+    int get() const noexcept {
+        const auto j = static_cast<std::size_t>(i);
+        return owner->keys[j] + owner->values[j];
+    }
+    operator int() const noexcept { return get(); }
+};
+
+template <class Base, class Proxy, class Pointer>
+class proxy_iterator : public Base::template type<proxy_iterator<Base, Proxy, Pointer>, Proxy, Pointer> {
+  public:
+    proxy_iterator() = default;
+    proxy_iterator(std::shared_ptr<storage> s, std::ptrdiff_t i) : s_(std::move(s)), i_(i) {}
+
+    Proxy operator*() const {
+        if constexpr (std::is_same_v<Proxy, ref_pair>)
+            return {s_->keys[static_cast<std::size_t>(i_)], s_->values[static_cast<std::size_t>(i_)]};
+        else
+            return {s_, i_};
+    }
+    proxy_iterator& operator+=(std::ptrdiff_t n) noexcept {
+        i_ += n;
+        return *this;
+    }
+    std::ptrdiff_t operator-(const proxy_iterator& other) const noexcept { return i_ - other.i_; }
+
+  private:
+    std::shared_ptr<storage> s_;
+    std::ptrdiff_t           i_ = 0;
+};
+
+std::shared_ptr<storage> make_storage() {
+    auto s = std::make_shared<storage>();
+    s->keys.resize(static_cast<std::size_t>(size));
+    s->values.resize(static_cast<std::size_t>(size));
+    std::iota(s->keys.begin(), s->keys.end(), 0);
+    std::iota(s->values.begin(), s->values.end(), 1);
+    return s;
+}
+
+template <class Base, class Proxy, class Pointer>
+void BM_ProxyArrow(benchmark::State& state) {
+    const auto                           s = make_storage();
+    proxy_iterator<Base, Proxy, Pointer> first(s, 0);
+    proxy_iterator<Base, Proxy, Pointer> last(s, size);
+    for (auto _ : state) {
+        int sum = 0;
+        for (auto it = first; it != last; ++it)
+            sum += it->get();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+} // namespace
+
+#define BEMAN_ITERATOR_INTERFACE_PROXY_ARROW_BENCHMARK(base, proxy)                                                 \
+    BENCHMARK(BM_ProxyArrow<base, proxy, base::arrow<proxy>>)->Name("BM_ProxyArrowInPlace/" #base "/" #proxy); \
+    BENCHMARK(BM_ProxyArrow<base, proxy, moving_arrow_result<proxy>>)->Name("BM_ProxyArrowMove/" #base "/" #proxy)
+
+BEMAN_ITERATOR_INTERFACE_PROXY_ARROW_BENCHMARK(crtp_base, ref_pair);
+BEMAN_ITERATOR_INTERFACE_PROXY_ARROW_BENCHMARK(crtp_base, shared_ref);
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+BEMAN_ITERATOR_INTERFACE_PROXY_ARROW_BENCHMARK(deducing_base, ref_pair);
+BEMAN_ITERATOR_INTERFACE_PROXY_ARROW_BENCHMARK(deducing_base, shared_ref);
+#endif
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/set_bit_iterator.bench.cpp -*-C++-*-
+
+// Summing the indices of the set bits of a bitmap of 16M bits, each set with
+// probability 2^-state.range(0): testing every bit through bit_iterator, and
+// with set_bit_iterator.  Then the same over the intersection of two such
+// bitmaps, ANDed into a temporary bitmap first or on the fly.
+
+#include <beman/iterator_interface/bit_iterator.hpp>
+#include <beman/iterator_interface/set_bit_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = std::ptrdiff_t(1) << 24;
+
+std::vector<std::uint64_t> make_words(std::int64_t sparsity, unsigned seed) {
+    std::mt19937_64            gen(seed);
+    std::vector<std::uint64_t> words(size / 64);
+    for (auto& w : words) {
+        w = ~std::uint64_t(0);
+        for (std::int64_t i = 0; i != sparsity; ++i)
+            w &= gen();
+    }
+    return words;
+}
+
+void BM_SetBitsPerBit(benchmark::State& state) {
+    const auto                                   words = make_words(state.range(0), 1);
+    const bii::bit_iterator<const std::uint64_t> b(words.data());
+    for (auto _ : state) {
+        std::ptrdiff_t sum = 0;
+        for (std::ptrdiff_t i = 0; i != size; ++i) {
+            if (b[i])
+                sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_SetBitIterator(benchmark::State& state) {
+    const auto words = make_words(state.range(0), 1);
+    for (auto _ : state) {
+        std::ptrdiff_t sum = 0;
+        for (std::ptrdiff_t i : bii::set_bit_indices(words.data(), size))
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_IntersectionMaterialized(benchmark::State& state) {
+    const auto                 a = make_words(state.range(0), 1);
+    const auto                 b = make_words(state.range(0), 2);
+    std::vector<std::uint64_t> c(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i != c.size(); ++i)
+            c[i] = a[i] & b[i];
+        std::ptrdiff_t sum = 0;
+        for (std::ptrdiff_t i : bii::set_bit_indices(c.data(), size))
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+void BM_IntersectionFused(benchmark::State& state) {
+    const auto a = make_words(state.range(0), 1);
+    const auto b = make_words(state.range(0), 2);
+    for (auto _ : state) {
+        std::ptrdiff_t sum = 0;
+        for (std::ptrdiff_t i : bii::set_bit_indices(a.data(), b.data(), size))
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+} // namespace
+
+BENCHMARK(BM_SetBitsPerBit)->Arg(1)->Arg(6)->Arg(12)->Arg(18);
+BENCHMARK(BM_SetBitIterator)->Arg(1)->Arg(6)->Arg(12)->Arg(18);
+BENCHMARK(BM_IntersectionMaterialized)->Arg(1)->Arg(3)->Arg(6)->Arg(9);
+BENCHMARK(BM_IntersectionFused)->Arg(1)->Arg(3)->Arg(6)->Arg(9);
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/strided_iterator.bench.cpp -*-C++-*-
+
+// Gathering 64K floats every stride elements into a contiguous buffer, plain
+// and scaled, with a hand-written loop over a run-time stride and with the
+// algorithm.hpp copy and transform over strided_iterator with a run-time and
+// a compile-time stride.
+//
+// The loops of read_n and of the transform hook vectorize: with GCC 12 -O3 on
+// x86-64, -fopt-info-vec-optimized reports them vectorized with 16-byte
+// vectors for compile-time strides 1 to 4 (copy with a stride of 1 goes to
+// memmove instead), and for a run-time stride, with the vectors filled one
+// element at a time.  From a stride of 8 on, GCC finds vectors unprofitable and keeps
+// the scalar loop, which is as fast as the hand-written one.
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/strided_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 16;
+
+std::vector<float> make_frames(std::ptrdiff_t stride) {
+    std::vector<float> v(static_cast<std::size_t>(size * stride));
+    std::iota(v.begin(), v.end(), 0.0f);
+    return v;
+}
+
+constexpr auto scale = [](float x) { return 0.5f * x; };
+
+void set_processed(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * size);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(float)));
+}
+
+template <bool Scale>
+void BM_GatherScalar(benchmark::State& state) {
+    std::ptrdiff_t     stride = state.range(0);
+    const auto         frames = make_frames(stride);
+    std::vector<float> out(static_cast<std::size_t>(size));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(stride);
+        const float* p = frames.data();
+        for (std::ptrdiff_t i = 0; i != size; ++i)
+            out[static_cast<std::size_t>(i)] = Scale ? scale(p[i * stride]) : p[i * stride];
+        benchmark::DoNotOptimize(out.data());
+    }
+    set_processed(state);
+}
+
+template <bool Scale, class Range>
+void gather(benchmark::State& state, std::ptrdiff_t stride, Range make_range) {
+    const auto         frames = make_frames(stride);
+    std::vector<float> out(static_cast<std::size_t>(size));
+    for (auto _ : state) {
+        const auto in = make_range(frames.data());
+        if constexpr (Scale)
+            bii::algorithms::transform(in.begin(), in.end(), out.data(), scale);
+        else
+            bii::algorithms::copy(in.begin(), in.end(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    set_processed(state);
+}
+
+template <bool Scale>
+void BM_GatherDynamic(benchmark::State& state) {
+    const std::ptrdiff_t stride = state.range(0);
+    gather<Scale>(state, stride, [stride](const float* p) { return bii::strided(p, stride, size); });
+}
+
+template <bool Scale, std::ptrdiff_t Stride>
+void BM_GatherStatic(benchmark::State& state) {
+    gather<Scale>(state, Stride, [](const float* p) { return bii::strided<Stride>(p, size); });
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_GatherScalar, false)->Arg(1)->Arg(2)->Arg(3)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_GatherDynamic, false)->Arg(1)->Arg(2)->Arg(3)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 1);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 2);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 3);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 4);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 8);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 16);
+BENCHMARK_TEMPLATE(BM_GatherStatic, false, 64);
+BENCHMARK_TEMPLATE(BM_GatherScalar, true)->Arg(1)->Arg(2)->Arg(3)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_GatherDynamic, true)->Arg(1)->Arg(2)->Arg(3)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 1);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 2);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 3);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 4);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 8);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 16);
+BENCHMARK_TEMPLATE(BM_GatherStatic, true, 64);
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/transform_iterator.bench.cpp -*-C++-*-
+
+// transform_view over 64K records with an expensive function (a hash of each
+// 64-byte record), with and without caching, under algorithms that compare
+// neighbouring elements (std::adjacent_find, std::is_sorted) and one that
+// dereferences each position once (std::lower_bound).  The calls counter is
+// the number of function calls per element of the view and per iteration.
+
+#include <beman/iterator_interface/transform_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::ptrdiff_t size = 1 << 16;
+
+struct record {
+    std::array<std::uint64_t, 8> words;
+};
+
+// Distinct records whose keys increase with their index.
+std::vector<record> records() {
+    std::vector<record> v(static_cast<std::size_t>(size));
+    for (std::size_t i = 0; i != v.size(); ++i) {
+        std::iota(v[i].words.begin(), v[i].words.end(), std::uint64_t(i) << 32);
+        v[i].words[0] = i;
+    }
+    return v;
+}
+
+// The record's first word, which orders the records, above 20 bits of a mix
+// of all the words that make each call cost a few hundred cycles.
+struct record_key {
+    std::uint64_t* calls = nullptr;
+
+    std::uint64_t operator()(const record& r) const {
+        ++*calls;
+        std::uint64_t h = 0x9e3779b97f4a7c15;
+        for (int round = 0; round != 4; ++round) {
+            for (std::uint64_t w : r.words) {
+                h ^= w + (h << 6) + (h >> 2);
+                h *= 0xff51afd7ed558ccd;
+            }
+        }
+        return (r.words[0] << 20) | (h >> 44);
+    }
+};
+
+template <std::size_t Cache>
+using key_view = bii::transform_view<const record*, record_key, Cache>;
+
+template <std::size_t Cache, class Algorithm>
+void BM_Transform(benchmark::State& state, Algorithm algorithm) {
+    const auto            v     = records();
+    std::uint64_t         calls = 0;
+    const key_view<Cache> view(v.data(), v.data() + v.size(), record_key{&calls});
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algorithm(view));
+    state.counters["calls"] = benchmark::Counter(
+        static_cast<double>(calls) / static_cast<double>(size), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+constexpr auto adjacent_find = [](const auto& view) { return std::adjacent_find(view.begin(), view.end()).base(); };
+constexpr auto is_sorted     = [](const auto& view) { return std::is_sorted(view.begin(), view.end()); };
+
+// One lookup of every 16th key: each probe dereferences a new position, so
+// caching does not save any call.
+constexpr auto lower_bound = [](const auto& view) {
+    std::ptrdiff_t found = 0;
+    for (std::uint64_t i = 0; i < std::uint64_t(size); i += 16)
+        found += std::lower_bound(view.begin(), view.end(), i << 20).base() - view.begin().base();
+    return found;
+};
+
+void BM_AdjacentFindPlain(benchmark::State& state) { BM_Transform<0>(state, adjacent_find); }
+void BM_AdjacentFindCached(benchmark::State& state) { BM_Transform<3>(state, adjacent_find); }
+void BM_IsSortedPlain(benchmark::State& state) { BM_Transform<0>(state, is_sorted); }
+void BM_IsSortedCached(benchmark::State& state) { BM_Transform<3>(state, is_sorted); }
+void BM_LowerBoundPlain(benchmark::State& state) { BM_Transform<0>(state, lower_bound); }
+void BM_LowerBoundCached(benchmark::State& state) { BM_Transform<3>(state, lower_bound); }
+
+} // namespace
+
+BENCHMARK(BM_AdjacentFindPlain);
+BENCHMARK(BM_AdjacentFindCached);
+BENCHMARK(BM_IsSortedPlain);
+BENCHMARK(BM_IsSortedCached);
+BENCHMARK(BM_LowerBoundPlain);
+BENCHMARK(BM_LowerBoundCached);
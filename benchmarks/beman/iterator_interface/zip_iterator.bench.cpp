@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// benchmarks/beman/iterator_interface/zip_iterator.bench.cpp -*-C++-*-
+
+// 1M rows of (key, x, y, id), stored as an array of structures and as four
+// columns traversed with zip_iterator: sorting the rows by key, 1M
+// lower_bound lookups of random keys, and computing x * y for every row,
+// which the columns do by zipping only x and y.
+
+#include <beman/iterator_interface/zip_iterator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+
+namespace bii = beman::iterator_interface;
+
+constexpr std::size_t size = std::size_t(1) << 20;
+
+struct row {
+    std::uint32_t key;
+    float         x;
+    float         y;
+    std::uint64_t id;
+};
+
+struct columns {
+    std::vector<std::uint32_t> key;
+    std::vector<float>         x;
+    std::vector<float>         y;
+    std::vector<std::uint64_t> id;
+
+    auto begin() { return bii::zip_iterator(key.begin(), x.begin(), y.begin(), id.begin()); }
+    auto end() { return bii::zip_iterator(key.end(), x.end(), y.end(), id.end()); }
+};
+
+std::vector<row> make_rows() {
+    std::mt19937                          gen(42);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<row>                      rows(size);
+    for (std::size_t i = 0; i != size; ++i)
+        rows[i] = {static_cast<std::uint32_t>(gen()), dist(gen), dist(gen), i};
+    return rows;
+}
+
+columns make_columns(const std::vector<row>& rows) {
+    columns c;
+    for (const row& r : rows) {
+        c.key.push_back(r.key);
+        c.x.push_back(r.x);
+        c.y.push_back(r.y);
+        c.id.push_back(r.id);
+    }
+    return c;
+}
+
+constexpr auto key_of = [](const auto& r) { return get<0>(r); };
+
+std::vector<std::uint32_t> make_queries() {
+    std::mt19937               gen(7);
+    std::vector<std::uint32_t> q(size);
+    std::generate(q.begin(), q.end(), [&] { return static_cast<std::uint32_t>(gen()); });
+    return q;
+}
+
+void BM_SortAoS(benchmark::State& state) {
+    const auto rows = make_rows();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = rows;
+        state.ResumeTiming();
+        std::ranges::sort(data, std::ranges::less(), &row::key);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_SortZip(benchmark::State& state) {
+    const auto cols = make_columns(make_rows());
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = cols;
+        state.ResumeTiming();
+        std::ranges::sort(data.begin(), data.end(), std::ranges::less(), key_of);
+        benchmark::DoNotOptimize(data.key.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_LowerBoundAoS(benchmark::State& state) {
+    auto rows = make_rows();
+    std::ranges::sort(rows, std::ranges::less(), &row::key);
+    const auto queries = make_queries();
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const std::uint32_t q : queries)
+            sum += std::ranges::lower_bound(rows, q, std::ranges::less(), &row::key)->id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_LowerBoundZip(benchmark::State& state) {
+    auto cols = make_columns(make_rows());
+    std::ranges::sort(cols.begin(), cols.end(), std::ranges::less(), key_of);
+    const auto queries = make_queries();
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const std::uint32_t q : queries)
+            sum += get<3>(*std::ranges::lower_bound(cols.begin(), cols.end(), q, std::ranges::less(), key_of));
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_TransformAoS(benchmark::State& state) {
+    const auto         rows = make_rows();
+    std::vector<float> out(size);
+    for (auto _ : state) {
+        std::ranges::transform(rows, out.begin(), [](const row& r) { return r.x * r.y; });
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+void BM_TransformZip(benchmark::State& state) {
+    auto               cols = make_columns(make_rows());
+    std::vector<float> out(size);
+    for (auto _ : state) {
+        std::ranges::transform(bii::zip_iterator(cols.x.begin(), cols.y.begin()),
+                               bii::zip_iterator(cols.x.end(), cols.y.end()),
+                               out.begin(),
+                               [](const auto& r) { return get<0>(r) * get<1>(r); });
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+} // namespace
+
+BENCHMARK(BM_SortAoS)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortZip)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LowerBoundAoS);
+BENCHMARK(BM_LowerBoundZip);
+BENCHMARK(BM_TransformAoS);
+BENCHMARK(BM_TransformZip);
@@ -0,0 +1,360 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/algorithm.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_ALGORITHM_HPP
+#define BEMAN_ITERATOR_INTERFACE_ALGORITHM_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+#include <beman/iterator_interface/segmented_iterator.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+// Drop-in replacements for the corresponding <algorithm> and <numeric>
+// functions.  When the iterators model segmented_iterator, the range is
+// processed as a sequence of tight loops over raw pointers, one per segment,
+// instead of paying the segment-boundary check on every increment.  Contiguous
+// iterators are lowered to raw pointers, so that the standard library's
+// memmove/memset paths apply to them too.  copy, copy_n, fill and fill_n also
+// use the read_n/write_n bulk transfer hooks (see iterator_interface_access)
+// of either side when available, find, count, fill, fill_n and equal the
+// whole-range hooks of the same names, given a value of the iterator's value
+// type, and transform the transform hook of its input, with a contiguous
+// output lowered to a pointer.  Otherwise they forward to the standard
+// algorithm.
+//
+// They are declared in namespace algorithms, which argument-dependent lookup
+// does not search for the iterators of this library, so that an unqualified
+// call such as copy(first, last, out) on them is never made ambiguous or
+// taken over by these unconstrained templates.
+
+namespace detail {
+template <class It, class Out>
+concept bulk_readable = requires(It& it, Out out, std::iter_difference_t<It> n) {
+    { iterator_interface_access::read_n(it, std::move(out), n) } -> std::same_as<Out>;
+};
+
+template <class It, class In>
+concept bulk_writable = requires(It& it, In in, std::iter_difference_t<It> n) {
+    { iterator_interface_access::write_n(it, std::move(in), n) } -> std::same_as<In>;
+};
+
+template <class It, class T>
+concept has_find = std::same_as<T, std::iter_value_t<It>> && requires(const It& it, const T& value) {
+    { iterator_interface_access::find(it, it, value) } -> std::same_as<It>;
+};
+
+template <class It, class T>
+concept has_count = std::same_as<T, std::iter_value_t<It>> && requires(const It& it, const T& value) {
+    { iterator_interface_access::count(it, it, value) } -> std::same_as<std::iter_difference_t<It>>;
+};
+
+template <class It, class T>
+concept has_fill = std::same_as<T, std::iter_value_t<It>> &&
+                   requires(const It& it, const T& value) { iterator_interface_access::fill(it, it, value); };
+
+template <class It1, class It2>
+concept has_equal = requires(const It1& it1, const It2& it2) {
+    { iterator_interface_access::equal(it1, it1, it2) } -> std::same_as<bool>;
+};
+
+template <class It>
+using pointer_to_t = decltype(std::to_address(std::declval<const It&>()));
+
+// Bulk transfer with the other side lowered to a pointer.
+template <class In, class Out>
+concept bulk_readable_to_pointer = std::contiguous_iterator<Out> && bulk_readable<In, pointer_to_t<Out>>;
+
+template <class Out, class In>
+concept bulk_writable_from_pointer = std::contiguous_iterator<In> && bulk_writable<Out, pointer_to_t<In>>;
+
+template <class It, class Out, class F>
+concept has_transform = requires(const It& it, Out out, F& op) {
+    { iterator_interface_access::transform(it, it, std::move(out), op) } -> std::same_as<Out>;
+};
+
+template <class It, class Out, class F>
+concept has_transform_to_pointer = std::contiguous_iterator<Out> && has_transform<It, pointer_to_t<Out>, F>;
+
+template <class In, class Out>
+concept bulk_copyable = bulk_readable<In, Out> || bulk_readable_to_pointer<In, Out> || bulk_writable<Out, In> ||
+                        bulk_writable_from_pointer<Out, In>;
+
+template <class In, class Out>
+    requires bulk_copyable<In, Out>
+constexpr Out bulk_copy_n(In first, std::iter_difference_t<In> n, Out out) {
+    if constexpr (bulk_readable<In, Out>) {
+        return iterator_interface_access::read_n(first, std::move(out), n);
+    } else if constexpr (bulk_readable_to_pointer<In, Out>) {
+        const auto o = std::to_address(out);
+        return out + (iterator_interface_access::read_n(first, o, n) - o);
+    } else if constexpr (bulk_writable<Out, In>) {
+        iterator_interface_access::write_n(out, std::move(first), n);
+        return out;
+    } else {
+        iterator_interface_access::write_n(out, std::to_address(first), n);
+        return out;
+    }
+}
+
+// An input iterator over an endless repetition of one value, used to fill
+// through write_n.
+template <class T>
+class repeat_iterator
+    : public ext_iterator_interface_compat<repeat_iterator<T>, std::input_iterator_tag, const T, const T&> {
+  public:
+    repeat_iterator() = default;
+    constexpr explicit repeat_iterator(const T& value) : value_(std::addressof(value)) {}
+
+    constexpr const T&         operator*() const noexcept { return *value_; }
+    constexpr repeat_iterator& operator++() noexcept { return *this; }
+    constexpr void             operator++(int) noexcept {}
+
+  private:
+    const T* value_ = nullptr;
+};
+
+template <class L>
+constexpr auto as_pointers(const L& first, const L& last) {
+    const auto p = std::to_address(first);
+    return std::pair(p, p + (last - first));
+}
+
+template <class T, class OutputIt>
+constexpr OutputIt copy_to(T* first, T* last, OutputIt out) {
+    if constexpr (bulk_writable<OutputIt, T*>) {
+        iterator_interface_access::write_n(out, first, last - first);
+        return out;
+    } else if constexpr (std::contiguous_iterator<OutputIt>) {
+        const auto o = std::to_address(out);
+        return out + (std::copy(first, last, o) - o);
+    } else {
+        return std::copy(first, last, std::move(out));
+    }
+}
+} // namespace detail
+
+namespace algorithms {
+template <class InputIt, class UnaryFunction>
+constexpr UnaryFunction for_each(InputIt first, InputIt last, UnaryFunction f) {
+    if constexpr (segmented_iterator<InputIt>) {
+        detail::visit_segments(first, last, [&f](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            std::for_each(p, q, std::ref(f));
+            return false;
+        });
+        return f;
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        std::for_each(p, q, std::ref(f));
+        return f;
+    } else {
+        return std::for_each(first, last, std::move(f));
+    }
+}
+
+template <class InputIt, class OutputIt>
+constexpr OutputIt copy(InputIt first, InputIt last, OutputIt out) {
+    if constexpr (segmented_iterator<InputIt>) {
+        detail::visit_segments(first, last, [&out](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            out               = detail::copy_to(p, q, std::move(out));
+            return false;
+        });
+        return out;
+    } else if constexpr (std::sized_sentinel_for<InputIt, InputIt> && detail::bulk_copyable<InputIt, OutputIt>) {
+        return detail::bulk_copy_n(first, last - first, std::move(out));
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        return detail::copy_to(p, q, std::move(out));
+    } else {
+        return std::copy(first, last, std::move(out));
+    }
+}
+
+template <class InputIt, class Size, class OutputIt>
+constexpr OutputIt copy_n(InputIt first, Size count, OutputIt out) {
+    if constexpr (segmented_iterator<InputIt> && std::random_access_iterator<InputIt>) {
+        return count > 0 ? algorithms::copy(first, first + count, std::move(out)) : out;
+    } else if constexpr (detail::bulk_copyable<InputIt, OutputIt>) {
+        return count > 0 ? detail::bulk_copy_n(first, count, std::move(out)) : out;
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto p = std::to_address(first);
+        return count > 0 ? detail::copy_to(p, p + count, std::move(out)) : out;
+    } else {
+        return std::copy_n(first, count, std::move(out));
+    }
+}
+
+template <class InputIt, class OutputIt, class UnaryOperation>
+constexpr OutputIt transform(InputIt first, InputIt last, OutputIt out, UnaryOperation op) {
+    if constexpr (detail::has_transform<InputIt, OutputIt, UnaryOperation>) {
+        return iterator_interface_access::transform(first, last, std::move(out), op);
+    } else if constexpr (detail::has_transform_to_pointer<InputIt, OutputIt, UnaryOperation>) {
+        const auto o = std::to_address(out);
+        return out + (iterator_interface_access::transform(first, last, o, op) - o);
+    } else if constexpr (segmented_iterator<InputIt>) {
+        detail::visit_segments(first, last, [&](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            out               = algorithms::transform(p, q, std::move(out), std::ref(op));
+            return false;
+        });
+        return out;
+    } else if constexpr (std::contiguous_iterator<InputIt> && std::contiguous_iterator<OutputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        const auto o      = std::to_address(out);
+        return out + (std::transform(p, q, o, std::move(op)) - o);
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        return std::transform(p, q, std::move(out), std::move(op));
+    } else {
+        return std::transform(first, last, std::move(out), std::move(op));
+    }
+}
+
+template <class ForwardIt, class T>
+constexpr void fill(ForwardIt first, ForwardIt last, const T& value) {
+    if constexpr (detail::has_fill<ForwardIt, T>) {
+        iterator_interface_access::fill(first, last, value);
+    } else if constexpr (segmented_iterator<ForwardIt>) {
+        detail::visit_segments(first, last, [&value](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            std::fill(p, q, value);
+            return false;
+        });
+    } else if constexpr (std::sized_sentinel_for<ForwardIt, ForwardIt> &&
+                         detail::bulk_writable<ForwardIt, detail::repeat_iterator<T>>) {
+        iterator_interface_access::write_n(first, detail::repeat_iterator<T>(value), last - first);
+    } else if constexpr (std::contiguous_iterator<ForwardIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        std::fill(p, q, value);
+    } else {
+        std::fill(first, last, value);
+    }
+}
+
+template <class OutputIt, class Size, class T>
+constexpr OutputIt fill_n(OutputIt first, Size count, const T& value) {
+    if (count <= 0)
+        return first;
+    if constexpr ((segmented_iterator<OutputIt> || detail::has_fill<OutputIt, T>) &&
+                  std::random_access_iterator<OutputIt>) {
+        const auto last = first + count;
+        algorithms::fill(first, last, value);
+        return last;
+    } else if constexpr (detail::bulk_writable<OutputIt, detail::repeat_iterator<T>>) {
+        iterator_interface_access::write_n(first, detail::repeat_iterator<T>(value), count);
+        return first;
+    } else if constexpr (std::contiguous_iterator<OutputIt>) {
+        std::fill_n(std::to_address(first), count, value);
+        return first + count;
+    } else {
+        return std::fill_n(std::move(first), count, value);
+    }
+}
+
+template <class InputIt, class T>
+constexpr InputIt find(InputIt first, InputIt last, const T& value) {
+    if constexpr (detail::has_find<InputIt, T>) {
+        return iterator_interface_access::find(first, last, value);
+    } else if constexpr (segmented_iterator<InputIt>) {
+        using traits   = segmented_iterator_traits<InputIt>;
+        InputIt result = last;
+        detail::visit_segments(first, last, [&](const auto& s, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            const auto it     = std::find(p, q, value);
+            if (it == q)
+                return false;
+            result = traits::compose(s, lfirst + (it - p));
+            return true;
+        });
+        return result;
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        return first + (std::find(p, q, value) - p);
+    } else {
+        return std::find(first, last, value);
+    }
+}
+
+template <class InputIt, class T>
+constexpr typename std::iterator_traits<InputIt>::difference_type
+count(InputIt first, InputIt last, const T& value) {
+    if constexpr (detail::has_count<InputIt, T>) {
+        return iterator_interface_access::count(first, last, value);
+    } else if constexpr (segmented_iterator<InputIt>) {
+        typename std::iterator_traits<InputIt>::difference_type n = 0;
+        detail::visit_segments(first, last, [&](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            n += std::count(p, q, value);
+            return false;
+        });
+        return n;
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        return std::count(p, q, value);
+    } else {
+        return std::count(first, last, value);
+    }
+}
+
+template <class InputIt1, class InputIt2>
+constexpr bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+    if constexpr (detail::has_equal<InputIt1, InputIt2>) {
+        return iterator_interface_access::equal(first1, last1, first2);
+    } else if constexpr (segmented_iterator<InputIt1>) {
+        bool result = true;
+        detail::visit_segments(first1, last1, [&](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            if constexpr (std::contiguous_iterator<InputIt2>) {
+                result = std::equal(p, q, std::to_address(first2));
+            } else {
+                result = std::equal(p, q, first2);
+            }
+            std::advance(first2, q - p);
+            return !result;
+        });
+        return result;
+    } else if constexpr (std::contiguous_iterator<InputIt1> && std::contiguous_iterator<InputIt2>) {
+        const auto [p, q] = detail::as_pointers(first1, last1);
+        return std::equal(p, q, std::to_address(first2));
+    } else {
+        return std::equal(first1, last1, first2);
+    }
+}
+
+template <class InputIt, class T, class BinaryOperation>
+constexpr T accumulate(InputIt first, InputIt last, T init, BinaryOperation op) {
+    if constexpr (segmented_iterator<InputIt>) {
+        detail::visit_segments(first, last, [&](const auto&, const auto& lfirst, const auto& llast) {
+            const auto [p, q] = detail::as_pointers(lfirst, llast);
+            init              = std::accumulate(p, q, std::move(init), op);
+            return false;
+        });
+        return init;
+    } else if constexpr (std::contiguous_iterator<InputIt>) {
+        const auto [p, q] = detail::as_pointers(first, last);
+        return std::accumulate(p, q, std::move(init), std::move(op));
+    } else {
+        return std::accumulate(first, last, std::move(init), std::move(op));
+    }
+}
+
+template <class InputIt, class T>
+constexpr T accumulate(InputIt first, InputIt last, T init) {
+    return algorithms::accumulate(first, last, std::move(init), std::plus<>());
+}
+} // namespace algorithms
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
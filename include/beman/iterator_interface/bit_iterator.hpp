@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/bit_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_BIT_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_BIT_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace detail {
+// The words bits are packed into: unsigned integers other than bool, possibly
+// const.
+template <class Word>
+concept bit_word = std::unsigned_integral<std::remove_const_t<Word>> && !std::same_as<std::remove_cv_t<Word>, bool>;
+
+template <class Word>
+inline constexpr std::ptrdiff_t word_bits = std::numeric_limits<std::remove_const_t<Word>>::digits;
+
+// A word with the low k bits set, 0 <= k <= word_bits.
+template <class W>
+constexpr W low_bits(std::ptrdiff_t k) noexcept {
+    return k >= word_bits<W> ? static_cast<W>(~W(0)) : static_cast<W>((W(1) << k) - 1);
+}
+
+// The k bits starting at bit pos of words, 0 < k <= word_bits, as the low bits
+// of a word.
+template <class W>
+constexpr W get_bits(const W* words, std::ptrdiff_t pos, std::ptrdiff_t k) noexcept {
+    const std::ptrdiff_t i = pos / word_bits<W>;
+    const std::ptrdiff_t s = pos % word_bits<W>;
+    W                    v = static_cast<W>(words[i] >> s);
+    if (s + k > word_bits<W>)
+        v = static_cast<W>(v | words[i + 1] << (word_bits<W> - s));
+    return static_cast<W>(v & low_bits<W>(k));
+}
+
+// Replaces the k bits starting at bit pos of words, 0 < k <= word_bits, with
+// the low bits of v, whose other bits are zero.
+template <class W>
+constexpr void set_bits(W* words, std::ptrdiff_t pos, std::ptrdiff_t k, W v) noexcept {
+    const std::ptrdiff_t i    = pos / word_bits<W>;
+    const std::ptrdiff_t s    = pos % word_bits<W>;
+    const W              mask = low_bits<W>(k);
+    words[i]                  = static_cast<W>((words[i] & ~(mask << s)) | v << s);
+    if (s + k > word_bits<W>) {
+        const std::ptrdiff_t r = word_bits<W> - s;
+        words[i + 1]           = static_cast<W>((words[i + 1] & ~(mask >> r)) | v >> r);
+    }
+}
+} // namespace detail
+
+// The reference type of bit_iterator over mutable words: a proxy for one bit,
+// which converts to bool and assigns through, even when const, as the
+// reference of std::vector<bool> does.
+template <detail::bit_word Word>
+class bit_reference {
+  public:
+    constexpr bit_reference(Word* word, Word mask) noexcept : word_(word), mask_(mask) {}
+
+    bit_reference(const bit_reference&) = default;
+
+    constexpr operator bool() const noexcept { return (*word_ & mask_) != 0; }
+    constexpr bool operator~() const noexcept { return !bool(*this); }
+
+    constexpr const bit_reference& operator=(bool value) const noexcept {
+        if (value)
+            *word_ |= mask_;
+        else
+            *word_ &= static_cast<Word>(~mask_);
+        return *this;
+    }
+
+    // Assigns the bit, not the reference.
+    constexpr const bit_reference& operator=(const bit_reference& other) const noexcept {
+        return *this = bool(other);
+    }
+
+    constexpr void flip() const noexcept { *word_ ^= mask_; }
+
+    friend constexpr void swap(const bit_reference& lhs, const bit_reference& rhs) noexcept {
+        const bool value = lhs;
+        lhs              = bool(rhs);
+        rhs              = value;
+    }
+
+  private:
+    Word* word_;
+    Word  mask_;
+};
+
+namespace detail {
+template <class Word>
+using bit_reference_t = std::conditional_t<std::is_const_v<Word>, bool, bit_reference<Word>>;
+} // namespace detail
+
+// A random access iterator over the bits of an array of Words, bit i being bit
+// i % word_bits of words[i / word_bits], i.e. the layout of bitsets and bitmap
+// indexes.  Its reference is bool when Word is const and a bit_reference
+// otherwise.
+//
+// The iterator holds the array and a bit index, so that moving it and taking
+// distances are single arithmetic operations.  The algorithm.hpp count, find,
+// fill, fill_n, copy, copy_n and equal functions work a word at a time on bit
+// ranges, with std::popcount and std::countr_zero, instead of bit by bit:
+// copy between bit ranges at different offsets shifts whole words into place.
+template <detail::bit_word Word = std::uint64_t>
+class bit_iterator : public ext_proxy_iterator_interface_compat<bit_iterator<Word>,
+                                                                std::random_access_iterator_tag,
+                                                                bool,
+                                                                detail::bit_reference_t<Word>,
+                                                                std::ptrdiff_t> {
+    using base_type = ext_proxy_iterator_interface_compat<bit_iterator<Word>,
+                                                          std::random_access_iterator_tag,
+                                                          bool,
+                                                          detail::bit_reference_t<Word>,
+                                                          std::ptrdiff_t>;
+    using word_type = std::remove_const_t<Word>;
+
+    static constexpr std::ptrdiff_t bits = detail::word_bits<Word>;
+
+  public:
+    using typename base_type::difference_type;
+    using typename base_type::reference;
+
+    bit_iterator() = default;
+
+    // Bit index of the array words.
+    constexpr explicit bit_iterator(Word* words, difference_type index = 0) noexcept
+        : words_(words), index_(index) {}
+
+    // From an iterator over mutable words to one over const words.
+    template <class U>
+        requires std::same_as<const U, Word> && (!std::same_as<U, Word>)
+    constexpr bit_iterator(const bit_iterator<U>& other) noexcept : words_(other.words()), index_(other.index()) {}
+
+    constexpr reference operator*() const noexcept {
+        Word* const     word = words_ + index_ / bits;
+        const word_type mask = static_cast<word_type>(word_type(1) << index_ % bits);
+        if constexpr (std::is_const_v<Word>)
+            return (*word & mask) != 0;
+        else
+            return reference(word, mask);
+    }
+
+    constexpr bit_iterator& operator+=(difference_type n) noexcept {
+        index_ += n;
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const bit_iterator& lhs, const bit_iterator& rhs) noexcept {
+        return lhs.index_ - rhs.index_;
+    }
+
+    friend constexpr bool operator==(const bit_iterator& lhs, const bit_iterator& rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+
+    constexpr Word*           words() const noexcept { return words_; }
+    constexpr difference_type index() const noexcept { return index_; }
+
+  private:
+    friend iterator_interface_access;
+
+    template <detail::bit_word>
+    friend class bit_iterator;
+
+    // Calls f(word, mask) for each word holding bits of [*this, last), with
+    // mask selecting those bits, until f returns true; returns the index of the
+    // first bit of that word, or last.index_.
+    template <class F>
+    constexpr difference_type visit_words(const bit_iterator& last, F f) const {
+        if (index_ >= last.index_)
+            return last.index_;
+        difference_type       i = index_ / bits;
+        const difference_type j = last.index_ / bits;
+        const difference_type e = last.index_ % bits;
+        word_type             mask = static_cast<word_type>(~word_type(0) << index_ % bits);
+        for (; i != j; ++i, mask = static_cast<word_type>(~word_type(0))) {
+            if (f(words_[i], mask))
+                return i * bits;
+        }
+        if (e != 0 && f(words_[j], static_cast<word_type>(mask & detail::low_bits<word_type>(e))))
+            return j * bits;
+        return last.index_;
+    }
+
+    constexpr difference_type count(const bit_iterator& last, bool value) const noexcept {
+        difference_type ones = 0;
+        visit_words(last, [&ones](word_type w, word_type mask) {
+            ones += std::popcount(static_cast<word_type>(w & mask));
+            return false;
+        });
+        return value ? ones : std::max<difference_type>(last.index_ - index_, 0) - ones;
+    }
+
+    constexpr bit_iterator find(const bit_iterator& last, bool value) const noexcept {
+        const word_type flip  = value ? word_type(0) : static_cast<word_type>(~word_type(0));
+        word_type       found = 0;
+        const auto      first = visit_words(last, [&](word_type w, word_type mask) {
+            found = static_cast<word_type>((w ^ flip) & mask);
+            return found != 0;
+        });
+        if (first == last.index_)
+            return last;
+        return bit_iterator(words_, first + std::countr_zero(found));
+    }
+
+    // The whole words in the middle are set with std::fill, i.e. memset.
+    constexpr void fill(const bit_iterator& last, bool value) const noexcept
+        requires(!std::is_const_v<Word>)
+    {
+        if (index_ >= last.index_)
+            return;
+        const word_type pattern = value ? static_cast<word_type>(~word_type(0)) : word_type(0);
+        const auto      set     = [pattern](word_type& w, word_type mask) {
+            w = static_cast<word_type>((w & ~mask) | (pattern & mask));
+        };
+        const difference_type i    = index_ / bits;
+        const difference_type j    = last.index_ / bits;
+        const word_type       head = static_cast<word_type>(~word_type(0) << index_ % bits);
+        const word_type       tail = detail::low_bits<word_type>(last.index_ % bits);
+        if (i == j) {
+            set(words_[i], static_cast<word_type>(head & tail));
+            return;
+        }
+        set(words_[i], head);
+        std::fill(words_ + i + 1, words_ + j, pattern);
+        if (tail != 0)
+            set(words_[j], tail);
+    }
+
+    // Ranges at the same offset in their words are compared word by word,
+    // others by shifting the words of first2 into place.
+    template <class U>
+        requires std::same_as<std::remove_const_t<U>, word_type>
+    constexpr bool equal(const bit_iterator& last, const bit_iterator<U>& first2) const noexcept {
+        if (index_ % bits == first2.index_ % bits) {
+            const word_type* other = first2.words_ + first2.index_ / bits;
+            return visit_words(last, [&other](word_type w, word_type mask) {
+                       return ((w ^ *other++) & mask) != 0;
+                   }) == last.index_;
+        }
+        const difference_type n = last.index_ - index_;
+        for (difference_type k = 0; k < n; k += bits) {
+            const difference_type m = std::min(bits, n - k);
+            if (detail::get_bits<word_type>(words_, index_ + k, m) !=
+                detail::get_bits<word_type>(first2.words_, first2.index_ + k, m))
+                return false;
+        }
+        return true;
+    }
+
+    // Copies to a bit range that does not overlap [*this, *this + n), or that
+    // starts before it.  Whole words of the destination are written with one
+    // store after the first.
+    constexpr bit_iterator<word_type> read_n(bit_iterator<word_type> out, difference_type n) noexcept {
+        if (n <= 0)
+            return out;
+        const difference_type head = std::min(n, bits - out.index_ % bits);
+        detail::set_bits(out.words_, out.index_, head, detail::get_bits<word_type>(words_, index_, head));
+        const difference_type full = (n - head) / bits;
+        word_type* const      o    = out.words_ + (out.index_ + head) / bits;
+        for (difference_type m = 0; m != full; ++m)
+            o[m] = detail::get_bits<word_type>(words_, index_ + head + m * bits, bits);
+        const difference_type k = head + full * bits;
+        if (k != n) {
+            const word_type tail = detail::get_bits<word_type>(words_, index_ + k, n - k);
+            detail::set_bits(out.words_, out.index_ + k, n - k, tail);
+        }
+        index_ += n;
+        out.index_ += n;
+        return out;
+    }
+
+    Word*           words_ = nullptr;
+    difference_type index_ = 0;
+};
+
+// The first count bits of the array words, as a range.
+template <detail::bit_word Word>
+constexpr std::ranges::subrange<bit_iterator<Word>> bits(Word* words, std::ptrdiff_t count) noexcept {
+    return {bit_iterator<Word>(words), bit_iterator<Word>(words, count)};
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/chunk_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_CHUNK_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_CHUNK_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace detail {
+template <class It>
+using chunk_t = std::conditional_t<std::contiguous_iterator<It>,
+                                   std::span<std::remove_reference_t<std::iter_reference_t<It>>>,
+                                   std::ranges::subrange<It>>;
+} // namespace detail
+
+// A random access iterator over the consecutive chunks of n elements of
+// [first, last), the last of which holds the remaining 1 to n elements.  The
+// chunks are std::spans when It is contiguous and std::ranges::subranges of It
+// otherwise, so that whole batches can be handed to vectorized kernels or I/O
+// calls.
+//
+// The iterator holds the start of the range, its size, n and the index of its
+// chunk: moving it and taking differences are single arithmetic operations,
+// including past the short chunk.
+template <std::random_access_iterator It>
+class chunk_iterator : public ext_proxy_iterator_interface_compat<chunk_iterator<It>,
+                                                                  std::random_access_iterator_tag,
+                                                                  detail::chunk_t<It>,
+                                                                  detail::chunk_t<It>,
+                                                                  std::iter_difference_t<It>> {
+    using base_type = ext_proxy_iterator_interface_compat<chunk_iterator<It>,
+                                                          std::random_access_iterator_tag,
+                                                          detail::chunk_t<It>,
+                                                          detail::chunk_t<It>,
+                                                          std::iter_difference_t<It>>;
+
+  public:
+    using typename base_type::difference_type;
+    using typename base_type::reference;
+
+    chunk_iterator() = default;
+
+    // The chunk index of the chunks of n > 0 elements of [first, last).
+    constexpr chunk_iterator(It first, It last, difference_type n, difference_type index = 0)
+        : first_(first), size_(last - first), n_(n), index_(index) {}
+
+    constexpr reference operator*() const {
+        const difference_type pos   = index_ * n_;
+        const It              first = first_ + pos;
+        const difference_type size  = std::min(n_, size_ - pos);
+        if constexpr (std::contiguous_iterator<It>)
+            return reference(std::to_address(first), static_cast<std::size_t>(size));
+        else
+            return reference(first, first + size);
+    }
+
+    constexpr chunk_iterator& operator+=(difference_type n) noexcept {
+        index_ += n;
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const chunk_iterator& lhs, const chunk_iterator& rhs) noexcept {
+        return lhs.index_ - rhs.index_;
+    }
+
+    friend constexpr bool operator==(const chunk_iterator& lhs, const chunk_iterator& rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+
+    // The start of the chunk.
+    constexpr It base() const { return first_ + std::min(index_ * n_, size_); }
+
+    // The number of elements in a full chunk.
+    constexpr difference_type chunk_size() const noexcept { return n_; }
+
+  private:
+    It              first_{};
+    difference_type size_  = 0;
+    difference_type n_     = 1;
+    difference_type index_ = 0;
+};
+
+// The chunks of n > 0 elements of r, as a range of chunk_iterators.
+template <std::ranges::random_access_range R>
+    requires std::ranges::sized_range<R> && std::ranges::borrowed_range<R>
+constexpr auto chunks(R&& r, std::ranges::range_difference_t<R> n) {
+    using It       = std::ranges::iterator_t<R>;
+    using iterator = chunk_iterator<It>;
+    const It   first = std::ranges::begin(r);
+    const It   last  = first + std::ranges::distance(r);
+    const auto count = (std::ranges::distance(r) + n - 1) / n;
+    return std::ranges::subrange<iterator>(iterator(first, last, n), iterator(first, last, n, count));
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
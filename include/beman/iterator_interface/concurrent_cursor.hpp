@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/concurrent_cursor.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_CONCURRENT_CURSOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_CONCURRENT_CURSOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+// A position in the random access range [first, last) shared by threads that
+// consume the range, each claiming the next chunk of it with one fetch_add.
+//
+// claim() sizes chunks by guided self-scheduling: a chunk is the remaining
+// length divided by twice the number of workers, but at least min_chunk.
+// Chunks are large while there is plenty of work, so the shared position is
+// rarely touched, and small towards the end, so the threads finish together.
+// claim(n) claims chunks of a fixed size instead.
+//
+// The cursor is neither copyable nor movable; the threads share it by
+// reference.
+template <std::random_access_iterator It>
+class concurrent_cursor {
+  public:
+    using difference_type = std::iter_difference_t<It>;
+
+    // Requires workers > 0 and min_chunk > 0.
+    concurrent_cursor(It first, It last, difference_type workers, difference_type min_chunk = 1)
+        : first_(std::move(first)), size_(last - first_), divisor_(2 * workers), min_chunk_(min_chunk) {}
+
+    concurrent_cursor(const concurrent_cursor&)            = delete;
+    concurrent_cursor& operator=(const concurrent_cursor&) = delete;
+
+    // The next chunk, or an empty range once the whole range is claimed.
+    std::ranges::subrange<It> claim() {
+        const difference_type pos = pos_.load(std::memory_order_relaxed);
+        if (pos >= size_)
+            return empty();
+        // Another thread may claim between the load and the fetch_add, making
+        // the chunk a little larger than intended; claim(n) trims it.
+        return claim(std::max((size_ - pos) / divisor_, min_chunk_));
+    }
+
+    // The next chunk of n elements (fewer at the end of the range), or an
+    // empty range once the whole range is claimed.  Requires n > 0.
+    std::ranges::subrange<It> claim(difference_type n) {
+        if (pos_.load(std::memory_order_relaxed) >= size_)
+            return empty();
+        const difference_type pos = pos_.fetch_add(n, std::memory_order_relaxed);
+        if (pos >= size_)
+            return empty();
+        return {first_ + pos, first_ + std::min(pos + n, size_)};
+    }
+
+    // The number of elements not claimed yet.
+    difference_type remaining() const noexcept {
+        return std::max(size_ - pos_.load(std::memory_order_relaxed), difference_type(0));
+    }
+
+  private:
+    std::ranges::subrange<It> empty() const { return {first_ + size_, first_ + size_}; }
+
+    It              first_;
+    difference_type size_;
+    difference_type divisor_;
+    difference_type min_chunk_;
+    // On a cache line of its own, so that claiming does not invalidate the
+    // line holding the fields above in the other threads' caches.
+    alignas(64) std::atomic<difference_type> pos_{0};
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
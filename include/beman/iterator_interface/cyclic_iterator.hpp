@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/cyclic_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_CYCLIC_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_CYCLIC_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+// A random access iterator over the endless repetition of the period
+// [first, first + size), e.g. for tiling a pattern or addressing a ring
+// buffer.  Position pos refers to first[pos mod size].
+//
+// The iterator keeps both the position and its offset within the period, so
+// that increments, decrements and short jumps never divide.  Copying out of it
+// with the algorithm.hpp functions goes through read_n: the partial first
+// period, one whole period, then copies of the output written so far (doubling
+// in length each time).  Writing into it through write_n only stores the last
+// size elements, as the ring would end up holding anyway.
+template <class T>
+class cyclic_iterator
+    : public ext_iterator_interface_compat<cyclic_iterator<T>, std::random_access_iterator_tag, T> {
+    using base_type = ext_iterator_interface_compat<cyclic_iterator<T>, std::random_access_iterator_tag, T>;
+
+  public:
+    using typename base_type::difference_type;
+
+    cyclic_iterator() = default;
+
+    // Requires size > 0.
+    constexpr cyclic_iterator(T* first, difference_type size, difference_type pos = 0)
+        : first_(first), size_(size), offset_(pos % size), pos_(pos) {
+        if (offset_ < 0)
+            offset_ += size_;
+    }
+
+    constexpr T& operator*() const noexcept { return first_[offset_]; }
+
+    constexpr cyclic_iterator& operator++() noexcept {
+        ++pos_;
+        if (++offset_ == size_)
+            offset_ = 0;
+        return *this;
+    }
+
+    constexpr cyclic_iterator& operator--() noexcept {
+        --pos_;
+        if (offset_ == 0)
+            offset_ = size_;
+        --offset_;
+        return *this;
+    }
+
+    using base_type::operator++;
+    using base_type::operator--;
+
+    constexpr cyclic_iterator& operator+=(difference_type n) noexcept {
+        pos_ += n;
+        if (n < -size_ || size_ < n)
+            n %= size_;
+        offset_ += n;
+        if (offset_ < 0)
+            offset_ += size_;
+        else if (offset_ >= size_)
+            offset_ -= size_;
+        return *this;
+    }
+
+    constexpr difference_type operator-(const cyclic_iterator& other) const noexcept { return pos_ - other.pos_; }
+
+    // Start of the period, its length, and the position of this iterator.
+    constexpr T*              period() const noexcept { return first_; }
+    constexpr difference_type period_size() const noexcept { return size_; }
+    constexpr difference_type position() const noexcept { return pos_; }
+
+  private:
+    friend iterator_interface_access;
+
+    template <class U>
+        requires std::same_as<std::remove_const_t<T>, U>
+    constexpr U* read_n(U* out, difference_type n) {
+        if (n <= 0)
+            return out;
+        const difference_type head = std::min(n, size_ - offset_);
+        out                        = std::copy(first_ + offset_, first_ + offset_ + head, out);
+        difference_type rest       = n - head;
+        if (rest < size_) {
+            out = std::copy(first_, first_ + rest, out);
+        } else {
+            // [period, out) is a whole number of periods, aligned on the
+            // start of one, so any prefix of it continues the sequence.
+            U* const period = out;
+            out             = std::copy(first_, first_ + size_, out);
+            rest -= size_;
+            for (difference_type done = size_; rest > 0; done *= 2) {
+                const difference_type chunk = std::min(done, rest);
+                out                         = std::copy(period, period + chunk, out);
+                rest -= chunk;
+            }
+        }
+        *this += n;
+        return out;
+    }
+
+    template <std::input_iterator In>
+        requires std::indirectly_writable<T*, std::iter_reference_t<In>>
+    constexpr In write_n(In in, difference_type n) {
+        if (n <= 0)
+            return in;
+        const difference_type skip = n - size_;
+        if (skip > 0) {
+            if constexpr (std::random_access_iterator<In>) {
+                in += skip;
+            } else {
+                for (difference_type i = 0; i != skip; ++i)
+                    ++in;
+            }
+            *this += skip;
+            n = size_;
+        }
+        const difference_type head = std::min(n, size_ - offset_);
+        for (T *p = first_ + offset_, *last = p + head; p != last; ++p, ++in)
+            *p = *in;
+        for (T *p = first_, *last = p + (n - head); p != last; ++p, ++in)
+            *p = *in;
+        *this += n;
+        return in;
+    }
+
+    T*              first_  = nullptr;
+    difference_type size_   = 0;
+    difference_type offset_ = 0;
+    difference_type pos_    = 0;
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
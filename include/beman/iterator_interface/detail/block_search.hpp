@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/detail/block_search.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_DETAIL_BLOCK_SEARCH_HPP
+#define BEMAN_ITERATOR_INTERFACE_DETAIL_BLOCK_SEARCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace beman {
+namespace iterator_interface {
+namespace detail {
+
+// Elements tested per block: a 64 byte cache line's worth, clamped to
+// [16, 64].
+template <class T>
+inline constexpr std::ptrdiff_t search_block_size =
+    std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(64 / sizeof(T)), 16, 64);
+
+// Returns the first p in [first, last) for which pred(*p) holds, or last.
+//
+// The predicate is evaluated on whole blocks into a byte mask, with no early
+// exit inside a block, so that the compiler can vectorize the test.  The mask
+// is then tested with a single branch per block, and only the block holding a
+// match is scanned a 64-bit word at a time, the lowest set byte of the first
+// non-zero word being the match.  pred must therefore be cheap and free of
+// side effects, and is also called on elements after the match.
+template <class T, class Pred>
+constexpr T* block_find_if(T* first, T* last, const Pred& pred) {
+    constexpr std::ptrdiff_t block = search_block_size<T>;
+    constexpr std::ptrdiff_t words = block / 8;
+    for (; last - first >= block; first += block) {
+        std::array<unsigned char, block> hits;
+        for (std::ptrdiff_t i = 0; i != block; ++i)
+            hits[static_cast<std::size_t>(i)] = static_cast<bool>(pred(first[i]));
+        const auto    mask = std::bit_cast<std::array<std::uint64_t, words>>(hits);
+        std::uint64_t any  = 0;
+        for (const std::uint64_t word : mask)
+            any |= word;
+        if (any == 0)
+            continue;
+        for (std::ptrdiff_t w = 0; w != words; ++w) {
+            const std::uint64_t word = mask[static_cast<std::size_t>(w)];
+            if (word == 0)
+                continue;
+            if constexpr (std::endian::native == std::endian::little)
+                return first + w * 8 + std::countr_zero(word) / 8;
+            else
+                return first + w * 8 + std::countl_zero(word) / 8;
+        }
+    }
+    for (; first != last; ++first) {
+        if (pred(*first))
+            break;
+    }
+    return first;
+}
+
+// Returns the mask whose bit i is set when p[i] == c, for the 64 bytes at p.
+//
+// As in block_find_if, the bytes are compared as a whole block, and a block
+// without a match costs one branch.  Otherwise the 0/1 comparison bytes are
+// packed into bits eight at a time with a multiplication, so that the caller
+// can walk successive matches with countr_zero instead of scanning again from
+// each one.
+constexpr std::uint64_t block_match_mask(const char* p, char c) noexcept {
+    std::array<unsigned char, 64> hits;
+    for (std::size_t i = 0; i != 64; ++i)
+        hits[i] = p[i] == c;
+    const auto    words = std::bit_cast<std::array<std::uint64_t, 8>>(hits);
+    std::uint64_t any   = 0;
+    for (const std::uint64_t word : words)
+        any |= word;
+    if (any == 0)
+        return 0;
+    std::uint64_t mask = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        // Byte i of a word holds hit i, at bit 8i; the product gathers bit 8i
+        // at bit 56 + i.
+        for (std::size_t w = 0; w != 8; ++w)
+            mask |= ((words[w] * 0x0102040810204080) >> 56) << (8 * w);
+    } else {
+        for (std::size_t i = 0; i != 64; ++i)
+            mask |= std::uint64_t(hits[i]) << i;
+    }
+    return mask;
+}
+
+} // namespace detail
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
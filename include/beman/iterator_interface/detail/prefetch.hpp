@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/detail/prefetch.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_DETAIL_PREFETCH_HPP
+#define BEMAN_ITERATOR_INTERFACE_DETAIL_PREFETCH_HPP
+
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+namespace detail {
+
+// Hints that the cache line holding p is about to be read.  A no-op on
+// compilers without __builtin_prefetch, and during constant evaluation.
+inline constexpr void prefetch(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!std::is_constant_evaluated())
+        __builtin_prefetch(p);
+#else
+    static_cast<void>(p);
+#endif
+}
+
+} // namespace detail
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -12,6 +12,7 @@
 #include <beman/iterator_interface/detail/stl_interfaces/fwd.hpp>
 #include <beman/iterator_interface/iterator_interface_access.hpp>
 
+#include <memory>
 #include <utility>
 #include <type_traits>
 #if defined(__cpp_lib_three_way_comparison)
@@ -24,9 +25,10 @@ namespace stl_interfaces {
 /** The return type of `operator->()` in a proxy iterator.
 
     This template is used as the default `Pointer` template parameter in
-    the `proxy_iterator_interface` template alias.  Note that the use of
-    this template implies a copy or move of the underlying object of type
-    `T`. */
+    the `proxy_iterator_interface` template alias.  `operator->()` builds
+    it with the `std::in_place_t` constructor, which initializes the
+    underlying object of type `T` directly from the result of `operator*()`;
+    the other constructors imply a copy or move. */
 template <typename T>
 #if defined(BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_DOXYGEN) || \
     BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_USE_CONCEPTS
@@ -38,6 +40,9 @@ template <typename T>
 {
     constexpr proxy_arrow_result(const T& value) noexcept(noexcept(T(value))) : value_(value) {}
     constexpr proxy_arrow_result(T&& value) noexcept(noexcept(T(std::move(value)))) : value_(std::move(value)) {}
+    template <typename F>
+    constexpr proxy_arrow_result(std::in_place_t, F&& f) noexcept(noexcept(T(std::forward<F>(f)())))
+        : value_(std::forward<F>(f)()) {}
 
     constexpr const T* operator->() const noexcept { return &value_; }
     constexpr T*       operator->() noexcept { return &value_; }
@@ -452,11 +457,45 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
         concept plus_eq = requires (D d) { d += DifferenceType(1); };
     // clang-format on
 
+    /** The comparison and difference operators take iterators by const
+        reference, so that comparing iterators that carry predicates,
+        buffers or shared_ptrs copies nothing.  They work on a copy instead
+        when it is free (small and trivially copyable) or when
+        `base_reference()` is not const. */
+    template <typename D>
+    // clang-format off
+        concept copy_operand =
+            (std::is_trivially_copyable_v<D> && sizeof(D) <= 2 * sizeof(void*)) ||
+            !requires (D const & d) { iterator_interface_access::base(d); };
+    // clang-format on
+
+    template <typename D>
+    using operand_t = std::conditional_t<copy_operand<D>, D, D const>;
+
+    template <typename D>
+    constexpr bool nothrow_operand() {
+        return !copy_operand<D> || std::is_nothrow_copy_constructible_v<D>;
+    }
+
+    template <typename D>
+    constexpr std::conditional_t<copy_operand<D>, D, D const&> operand(D const& d) noexcept(nothrow_operand<D>()) {
+        return d;
+    }
+
+    template <typename D1, typename D2 = D1>
+    // clang-format off
+        concept base_sub = requires (operand_t<D1> & d1, operand_t<D2> & d2) {
+            iterator_interface_access::base(d1) - iterator_interface_access::base(d2);
+        };
+    // clang-format on
+
     template <typename D, typename D2 = D>
     // clang-format off
         concept base_3way =
 #if defined(__cpp_impl_three_way_comparison)
-            requires (D d, D2 d2) { iterator_interface_access::base(d) <=> iterator_interface_access::base(d2); };
+            requires (operand_t<D> & d, operand_t<D2> & d2) {
+                iterator_interface_access::base(d) <=> iterator_interface_access::base(d2);
+            };
 #else
             false;
 #endif
@@ -464,18 +503,81 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
 
     template <typename D1, typename D2 = D1>
     // clang-format off
-        concept base_eq =
-            requires (D1 d1, D2 d2) { iterator_interface_access::base(d1) == iterator_interface_access::base(d2); };
+        concept base_eq = requires (operand_t<D1> & d1, operand_t<D2> & d2) {
+            iterator_interface_access::base(d1) == iterator_interface_access::base(d2);
+        };
     // clang-format on
 
     template <typename D, typename D2 = D>
     // clang-format off
-        concept iter_sub = requires (D d, D2 d2) {
+        concept iter_sub = requires (operand_t<D> & d, operand_t<D2> & d2) {
             typename D::difference_type;
             {d - d2} -> std::convertible_to<typename D::difference_type>;
         };
     // clang-format on
 
+    // Exception specifications of the free operators: each is noexcept when
+    // the operations on the derived iterators that it is implemented with
+    // are.
+    template <typename D1, typename D2>
+    constexpr bool nothrow_operands() {
+        return nothrow_operand<D1>() && nothrow_operand<D2>();
+    }
+
+    template <typename D>
+    constexpr bool nothrow_advance() {
+        return std::is_nothrow_copy_constructible_v<D> &&
+               noexcept(std::declval<D&>() += std::declval<typename D::difference_type>());
+    }
+
+    template <typename D1, typename D2>
+    constexpr bool nothrow_base_sub() {
+        return nothrow_operands<D1, D2>() &&
+               noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) -
+                        iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+    }
+
+    template <typename D1, typename D2>
+    constexpr bool nothrow_iter_sub() {
+        return nothrow_operands<D1, D2>() && noexcept(std::declval<operand_t<D1>&>() - std::declval<operand_t<D2>&>());
+    }
+
+    template <typename D1, typename D2>
+    constexpr bool nothrow_3way() {
+        if constexpr (base_3way<D1, D2>) {
+            return nothrow_operands<D1, D2>() &&
+                   noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) <=>
+                            iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+        } else {
+            return nothrow_iter_sub<D2, D1>();
+        }
+    }
+
+    template <typename D1, typename D2>
+    constexpr bool nothrow_eq() {
+        if constexpr (base_eq<D1, D2>) {
+            return nothrow_operands<D1, D2>() &&
+                   noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) ==
+                            iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+        } else {
+            return nothrow_iter_sub<D1, D2>();
+        }
+    }
+
+    // The exception specification of operator[](), for an iterator D
+    // derived from iterator_interface.
+    template <typename D, typename DifferenceType>
+    constexpr bool nothrow_subscript() {
+        if constexpr (requires (D it, DifferenceType n) { it += n; }) {
+            return std::is_nothrow_copy_constructible_v<D> && noexcept(std::declval<D&>() += DifferenceType()) &&
+                   noexcept(*std::declval<D&>());
+        } else {
+            return std::is_nothrow_copy_constructible_v<D> &&
+                   noexcept(std::declval<D&>() = std::declval<D&>() + DifferenceType()) &&
+                   noexcept(*std::declval<D&>());
+        }
+    }
+
     // This iterator concept -> category mapping scheme follows the one
     // from zip_transform_view; see
     // https://eel.is/c++draft/range.zip.transform.iterator#1.
@@ -513,6 +615,78 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
         using tag_t = decltype(v2_dtl::category_tag<IteratorConcept, ReferenceType>());
         return !std::same_as<tag_t, std::input_iterator_tag>;
     }
+
+    template <typename IteratorConcept,
+              typename ReferenceType,
+              bool Contiguous = std::derived_from<IteratorConcept, std::contiguous_iterator_tag>>
+    struct element_type_base {};
+
+    template <typename IteratorConcept, typename ReferenceType>
+    struct element_type_base<IteratorConcept, ReferenceType, true> {
+        using element_type = std::remove_reference_t<ReferenceType>;
+    };
+
+    // Proxy iterators get an operator->() when their pointer type can hold
+    // a reference, e.g. proxy_arrow_result, or when the derived iterator
+    // provides its own arrow().
+    template <typename Pointer, typename Reference>
+    concept proxy_pointer = !std::is_reference_v<Reference> &&
+                            (std::is_constructible_v<Pointer, std::in_place_t, Reference (*)()> ||
+                             std::is_constructible_v<Pointer, Reference>);
+
+    template <typename D>
+    concept arrow_hook = requires (D& d) { iterator_interface_access::arrow(d); };
+
+    template <typename Pointer, typename Reference, typename D>
+    concept has_arrow = arrow_hook<D> || std::is_reference_v<Reference> || proxy_pointer<Pointer, Reference>;
+
+    template <typename D>
+    concept iter_move_hook = requires (D const& d) { iterator_interface_access::iter_move(d); };
+
+    template <typename D>
+    concept iter_swap_hook = requires (D const& d) { iterator_interface_access::iter_swap(d, d); };
+
+    // Implements operator->().  For contiguous iterators the address is
+    // obtained without dereferencing, so that std::to_address() is valid on
+    // past-the-end iterators.  For proxies, the result of operator*() is
+    // constructed in place inside the pointer type when it supports that.
+    template <typename Pointer, typename Reference, typename IteratorConcept, typename D>
+    constexpr bool nothrow_arrow() {
+        if constexpr (requires (D& d) { iterator_interface_access::to_address(d); }) {
+            return noexcept(iterator_interface_access::to_address(std::declval<D&>()));
+        } else if constexpr (arrow_hook<D>) {
+            return noexcept(iterator_interface_access::arrow(std::declval<D&>()));
+        } else if constexpr (std::derived_from<IteratorConcept, std::contiguous_iterator_tag> &&
+                             requires (D& d) { std::to_address(iterator_interface_access::base(d)); }) {
+            return noexcept(std::to_address(iterator_interface_access::base(std::declval<D&>())));
+        } else if constexpr (std::is_reference_v<Reference>) {
+            return noexcept(*std::declval<D&>()) &&
+                   (std::is_pointer_v<Pointer> || std::is_nothrow_constructible_v<Pointer, Reference>);
+        } else if constexpr (std::is_constructible_v<Pointer, std::in_place_t, Reference (*)()>) {
+            return noexcept(*std::declval<D&>()) &&
+                   std::is_nothrow_constructible_v<Pointer, std::in_place_t, Reference (*)() noexcept>;
+        } else {
+            return noexcept(Pointer(*std::declval<D&>()));
+        }
+    }
+
+    template <typename Pointer, typename Reference, typename IteratorConcept, typename D>
+    constexpr auto arrow(D& d) noexcept(nothrow_arrow<Pointer, Reference, IteratorConcept, D>()) {
+        if constexpr (requires { iterator_interface_access::to_address(d); }) {
+            return iterator_interface_access::to_address(d);
+        } else if constexpr (arrow_hook<D>) {
+            return iterator_interface_access::arrow(d);
+        } else if constexpr (std::derived_from<IteratorConcept, std::contiguous_iterator_tag> &&
+                             requires { std::to_address(iterator_interface_access::base(d)); }) {
+            return std::to_address(iterator_interface_access::base(d));
+        } else if constexpr (std::is_reference_v<Reference>) {
+            return detail::make_pointer<Pointer, Reference>(*d);
+        } else if constexpr (std::is_constructible_v<Pointer, std::in_place_t, Reference (*)()>) {
+            return Pointer(std::in_place, [&d]() noexcept(noexcept(*d)) -> Reference { return *d; });
+        } else {
+            return Pointer(*d);
+        }
+    }
     } // namespace v2_dtl
 
     // clang-format off
@@ -534,7 +708,8 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
       typename DifferenceType = std::ptrdiff_t>
       requires std::is_class_v<D> && std::same_as<D, std::remove_cv_t<D>>
     struct iterator_interface
-        : v2_dtl::iterator_category_base<IteratorConcept, Reference>
+        : v2_dtl::iterator_category_base<IteratorConcept, Reference>,
+          v2_dtl::element_type_base<IteratorConcept, Reference>
     {
     private:
       constexpr D& derived() noexcept {
@@ -552,43 +727,54 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
       using difference_type = DifferenceType;
 
       constexpr decltype(auto) operator*()
+        noexcept(noexcept(*iterator_interface_access::base(std::declval<D&>())))
         requires requires (D d) { *iterator_interface_access::base(d); } {
           return *iterator_interface_access::base(derived());
         }
       constexpr decltype(auto) operator*() const
+        noexcept(noexcept(*iterator_interface_access::base(std::declval<D const&>())))
         requires requires (D const d) { *iterator_interface_access::base(d); } {
           return *iterator_interface_access::base(derived());
         }
 
       constexpr auto operator->()
-        requires (!std::same_as<pointer, void> && std::is_reference_v<reference> &&
+        noexcept(v2_dtl::nothrow_arrow<pointer, reference, IteratorConcept, D>())
+        requires (!std::same_as<pointer, void> && v2_dtl::has_arrow<pointer, reference, D> &&
                   requires (D d) { *d; }) {
-          return detail::make_pointer<pointer, reference>(*derived());
+          return v2_dtl::arrow<pointer, reference, IteratorConcept>(derived());
         }
       constexpr auto operator->() const
-        requires (!std::same_as<pointer, void> && std::is_reference_v<reference> &&
+        noexcept(v2_dtl::nothrow_arrow<pointer, reference, IteratorConcept, D const>())
+        requires (!std::same_as<pointer, void> && v2_dtl::has_arrow<pointer, reference, D const> &&
                   requires (D const d) { *d; }) {
-          return detail::make_pointer<pointer, reference>(*derived());
+          return v2_dtl::arrow<pointer, reference, IteratorConcept>(derived());
         }
 
       constexpr decltype(auto) operator[](difference_type n) const
-        requires requires (D const d) { d + n; } {
+        noexcept(v2_dtl::nothrow_subscript<D, difference_type>())
+        requires requires (D d) { d += n; } {
         D retval = derived();
         retval += n;
         return *retval;
       }
 
       constexpr decltype(auto) operator++()
+        noexcept(noexcept(++iterator_interface_access::base(std::declval<D&>())))
         requires requires (D d) { ++iterator_interface_access::base(d); } &&
           (!v2_dtl::plus_eq<D, difference_type>) {
             ++iterator_interface_access::base(derived());
             return derived();
           }
       constexpr decltype(auto) operator++()
+        noexcept(noexcept(std::declval<D&>() += difference_type(1)))
         requires requires (D d) { d += difference_type(1); } {
           return derived() += difference_type(1);
         }
-      constexpr auto operator++(int) requires requires (D d) { ++d; } {
+      constexpr auto operator++(int)
+        noexcept(noexcept(++std::declval<D&>()) &&
+                 (std::is_same_v<IteratorConcept, std::input_iterator_tag> ||
+                  std::is_nothrow_copy_constructible_v<D>))
+        requires requires (D d) { ++d; } {
         if constexpr (std::is_same_v<IteratorConcept, std::input_iterator_tag>){
           ++derived();
         } else {
@@ -598,30 +784,52 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
         }
       }
       constexpr decltype(auto) operator+=(difference_type n)
+        noexcept(noexcept(iterator_interface_access::base(std::declval<D&>()) += n))
         requires requires (D d) { iterator_interface_access::base(d) += n; } {
           iterator_interface_access::base(derived()) += n;
           return derived();
         }
 
       constexpr decltype(auto) operator--()
+        noexcept(noexcept(--iterator_interface_access::base(std::declval<D&>())))
         requires requires (D d) { --iterator_interface_access::base(d); } &&
           (!v2_dtl::plus_eq<D, difference_type>) {
             --iterator_interface_access::base(derived());
             return derived();
           }
       constexpr decltype(auto) operator--()
+        noexcept(noexcept(std::declval<D&>() += -difference_type(1)))
         requires requires (D d) { d += -difference_type(1); } {
           return derived() += -difference_type(1);
         }
-      constexpr auto operator--(int) requires requires (D d) { --d; } {
+      constexpr auto operator--(int)
+        noexcept(noexcept(--std::declval<D&>()) && std::is_nothrow_copy_constructible_v<D>)
+        requires requires (D d) { --d; } {
         D retval = derived();
         --derived();
         return retval;
       }
       constexpr decltype(auto) operator-=(difference_type n)
+        noexcept(noexcept(std::declval<D&>() += -n))
         requires requires (D d) { d += -n; } {
           return derived() += -n;
         }
+
+      // std::ranges::iter_move and iter_swap, when D supplies them through
+      // iterator_interface_access.
+      template<typename D2 = D>
+        requires v2_dtl::iter_move_hook<D2>
+      friend constexpr decltype(auto) iter_move(D const & it)
+        noexcept(noexcept(iterator_interface_access::iter_move(std::declval<D2 const&>()))) {
+          return iterator_interface_access::iter_move(static_cast<D2 const&>(it));
+        }
+      template<typename D2 = D>
+        requires v2_dtl::iter_swap_hook<D2>
+      friend constexpr void iter_swap(D const & lhs, D const & rhs)
+        noexcept(noexcept(iterator_interface_access::iter_swap(std::declval<D2 const&>(),
+                                                               std::declval<D2 const&>()))) {
+          iterator_interface_access::iter_swap(static_cast<D2 const&>(lhs), static_cast<D2 const&>(rhs));
+        }
     };
 
     namespace v2_dtl {
@@ -646,33 +854,42 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
 
     template<typename D>
       constexpr auto operator+(D it, typename D::difference_type n)
+        noexcept(v2_dtl::nothrow_advance<D>())
         requires v2_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
     template<typename D>
       constexpr auto operator+(typename D::difference_type n, D it)
+        noexcept(v2_dtl::nothrow_advance<D>())
         requires v2_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
 
     template<typename D1, typename D2>
-      constexpr auto operator-(D1 lhs, D2 rhs)
-        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
-                 requires { iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); }
-          { return iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); }
+      constexpr auto operator-(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_base_sub<D1, D2>())
+        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::base_sub<D1, D2> {
+          auto && l = v2_dtl::operand(lhs);
+          auto && r = v2_dtl::operand(rhs);
+          return iterator_interface_access::base(l) - iterator_interface_access::base(r);
+        }
     template<typename D>
       constexpr auto operator-(D it, typename D::difference_type n)
+        noexcept(v2_dtl::nothrow_advance<D>())
         requires v2_dtl::derived_iter<D> && requires { it += -n; }
           { return it += -n; }
 
 #if defined(__cpp_lib_three_way_comparison)
     template<typename D1, typename D2>
-      constexpr auto operator<=>(D1 lhs, D2 rhs)
+      constexpr auto operator<=>(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_3way<D1, D2>())
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
         (v2_dtl::base_3way<D1, D2> || v2_dtl::iter_sub<D1, D2>) {
+        auto && l = v2_dtl::operand(lhs);
+        auto && r = v2_dtl::operand(rhs);
         if constexpr (v2_dtl::base_3way<D1, D2>) {
-            return iterator_interface_access::base(lhs) <=> iterator_interface_access::base(rhs);
+            return iterator_interface_access::base(l) <=> iterator_interface_access::base(r);
           } else {
             using diff_type = typename D1::difference_type;
-            diff_type const diff = rhs - lhs;
+            diff_type const diff = r - l;
             return diff < diff_type(0) ? std::strong_ordering::less :
               diff_type(0) < diff ? std::strong_ordering::greater :
               std::strong_ordering::equal;
@@ -680,36 +897,56 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V2 {
         }
 #endif
     template<typename D1, typename D2>
-      constexpr bool operator<(D1 lhs, D2 rhs)
-        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) < typename D1::difference_type(0); }
+      constexpr bool operator<(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2_dtl::operand(lhs);
+          auto && r = v2_dtl::operand(rhs);
+          return (l - r) < typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator<=(D1 lhs, D2 rhs)
-        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) <= typename D1::difference_type(0); }
+      constexpr bool operator<=(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2_dtl::operand(lhs);
+          auto && r = v2_dtl::operand(rhs);
+          return (l - r) <= typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator>(D1 lhs, D2 rhs)
-        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) > typename D1::difference_type(0); }
+      constexpr bool operator>(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2_dtl::operand(lhs);
+          auto && r = v2_dtl::operand(rhs);
+          return (l - r) > typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator>=(D1 lhs, D2 rhs)
-        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) >= typename D1::difference_type(0); }
+      constexpr bool operator>=(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2_dtl::operand(lhs);
+          auto && r = v2_dtl::operand(rhs);
+          return (l - r) >= typename D1::difference_type(0);
+        }
 
     template<typename D1, typename D2>
-      constexpr bool operator==(D1 lhs, D2 rhs)
+      constexpr bool operator==(D1 const & lhs, D2 const & rhs)
+        noexcept(v2_dtl::nothrow_eq<D1, D2>())
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
                  detail::interoperable<D1, D2>::value &&
         (v2_dtl::base_eq<D1, D2> || v2_dtl::iter_sub<D1, D2>) {
+        auto && l = v2_dtl::operand(lhs);
+        auto && r = v2_dtl::operand(rhs);
         if constexpr (v2_dtl::base_eq<D1, D2>) {
-          return (iterator_interface_access::base(lhs) == iterator_interface_access::base(rhs));
+          return (iterator_interface_access::base(l) == iterator_interface_access::base(r));
         } else if constexpr (v2_dtl::iter_sub<D1, D2>) {
-          return (lhs - rhs) == typename D1::difference_type(0);
+          return (l - r) == typename D1::difference_type(0);
         }
       }
 
     template<typename D1, typename D2>
-      constexpr auto operator!=(D1 lhs, D2 rhs) -> decltype(!(lhs == rhs))
+      constexpr auto operator!=(D1 const & lhs, D2 const & rhs) noexcept(noexcept(!(lhs == rhs)))
+        -> decltype(!(lhs == rhs))
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2>
           { return !(lhs == rhs); }
 
@@ -752,7 +989,8 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V3 {
       typename Pointer = ValueType *,
       typename DifferenceType = std::ptrdiff_t>
     struct iterator_interface
-        : v2::v2_dtl::iterator_category_base<IteratorConcept, Reference>
+        : v2::v2_dtl::iterator_category_base<IteratorConcept, Reference>,
+          v2::v2_dtl::element_type_base<IteratorConcept, Reference>
     {
       using iterator_concept = IteratorConcept;
       using value_type = std::remove_const_t<ValueType>;
@@ -761,32 +999,47 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V3 {
       using difference_type = DifferenceType;
 
       constexpr decltype(auto) operator*(this auto&& self)
+          noexcept(noexcept(*iterator_interface_access::base(self)))
           requires requires { *iterator_interface_access::base(self); } {
           return *iterator_interface_access::base(self);
       }
 
       constexpr auto operator->(this auto&& self)
-        requires (!std::same_as<pointer, void>) && std::is_reference_v<reference> && requires { *self; } {
-          return detail::make_pointer<pointer, reference>(*self);
+        noexcept(v2::v2_dtl::nothrow_arrow<pointer, reference, IteratorConcept,
+                                           std::remove_reference_t<decltype(self)>>())
+        requires (!std::same_as<pointer, void>) &&
+                 v2::v2_dtl::has_arrow<pointer, reference, std::remove_reference_t<decltype(self)>> &&
+                 requires { *self; } {
+          return v2::v2_dtl::arrow<pointer, reference, IteratorConcept>(self);
         }
 
       constexpr decltype(auto) operator[](this auto const& self, difference_type n)
-        requires requires { self + n; } {
+        noexcept(v2::v2_dtl::nothrow_subscript<std::remove_cvref_t<decltype(self)>, difference_type>())
+        requires requires (std::remove_cvref_t<decltype(self)> it) { it += n; } || requires { self + n; } {
         auto retval = self;
-        retval = retval + n;
+        if constexpr (requires { retval += n; })
+          retval += n;
+        else
+          retval = retval + n;
         return *retval;
       }
 
       constexpr decltype(auto) operator++(this auto& self)
+        noexcept(noexcept(++iterator_interface_access::base(self)))
         requires requires { ++iterator_interface_access::base(self); } && (!requires { self += difference_type(1); }) {
           ++iterator_interface_access::base(self);
           return self;
         }
       constexpr decltype(auto) operator++(this auto& self)
+        noexcept(noexcept(self += difference_type(1)))
         requires requires { self += difference_type(1); } {
           return self += difference_type(1);
         }
-      constexpr auto operator++(this auto& self, int) requires requires { ++self; } {
+      constexpr auto operator++(this auto& self, int)
+        noexcept(noexcept(++self) &&
+                 (std::is_same_v<IteratorConcept, std::input_iterator_tag> ||
+                  std::is_nothrow_copy_constructible_v<std::remove_cvref_t<decltype(self)>>))
+        requires requires { ++self; } {
         if constexpr (std::is_same_v<IteratorConcept, std::input_iterator_tag>){
           ++self;
         } else {
@@ -796,29 +1049,48 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V3 {
         }
       }
       constexpr decltype(auto) operator+=(this auto& self, difference_type n)
+        noexcept(noexcept(iterator_interface_access::base(self) += n))
         requires requires { iterator_interface_access::base(self) += n; } {
           iterator_interface_access::base(self) += n;
           return self;
         }
 
       constexpr decltype(auto) operator--(this auto& self)
+          noexcept(noexcept(--iterator_interface_access::base(self)))
           requires requires { --iterator_interface_access::base(self); } && (!requires { self += difference_type(1); }) {
             --iterator_interface_access::base(self);
             return self;
           }
       constexpr decltype(auto) operator--(this auto& self)
+        noexcept(noexcept(self += -difference_type(1)))
         requires requires { self += -difference_type(1); } {
           return self += -difference_type(1);
         }
-      constexpr auto operator--(this auto& self, int) requires requires { --self; } {
+      constexpr auto operator--(this auto& self, int)
+        noexcept(noexcept(--self) && std::is_nothrow_copy_constructible_v<std::remove_cvref_t<decltype(self)>>)
+        requires requires { --self; } {
         auto retval = self;
         --self;
         return retval;
       }
       constexpr decltype(auto) operator-=(this auto& self, difference_type n)
+        noexcept(noexcept(self += -n))
         requires requires { self += -n; } {
           return self += -n;
         }
+
+      template<typename D>
+        requires std::derived_from<D, iterator_interface> && v2::v2_dtl::iter_move_hook<D>
+      friend constexpr decltype(auto) iter_move(D const & it)
+        noexcept(noexcept(iterator_interface_access::iter_move(it))) {
+          return iterator_interface_access::iter_move(it);
+        }
+      template<typename D>
+        requires std::derived_from<D, iterator_interface> && v2::v2_dtl::iter_swap_hook<D>
+      friend constexpr void iter_swap(D const & lhs, D const & rhs)
+        noexcept(noexcept(iterator_interface_access::iter_swap(lhs, rhs))) {
+          iterator_interface_access::iter_swap(lhs, rhs);
+        }
     };
 
     namespace v3_dtl {
@@ -841,33 +1113,42 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V3 {
 
     template<typename D>
       constexpr auto operator+(D it, typename D::difference_type n)
+        noexcept(v2::v2_dtl::nothrow_advance<D>())
         requires v3_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
     template<typename D>
       constexpr auto operator+(typename D::difference_type n, D it)
+        noexcept(v2::v2_dtl::nothrow_advance<D>())
         requires v3_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
 
     template<typename D1, typename D2>
-      constexpr auto operator-(D1 lhs, D2 rhs)
-        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
-                 requires { iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); }
-          { return iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); }
+      constexpr auto operator-(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_base_sub<D1, D2>())
+        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::base_sub<D1, D2> {
+          auto && l = v2::v2_dtl::operand(lhs);
+          auto && r = v2::v2_dtl::operand(rhs);
+          return iterator_interface_access::base(l) - iterator_interface_access::base(r);
+        }
     template<typename D>
       constexpr auto operator-(D it, typename D::difference_type n)
+        noexcept(v2::v2_dtl::nothrow_advance<D>())
         requires v3_dtl::derived_iter<D> && requires { it += -n; }
           { return it += -n; }
 
 #if defined(__cpp_lib_three_way_comparison)
     template<typename D1, typename D2>
-      constexpr auto operator<=>(D1 lhs, D2 rhs)
+      constexpr auto operator<=>(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_3way<D1, D2>())
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
         (v2::v2_dtl::base_3way<D1, D2> || v2::v2_dtl::iter_sub<D1, D2>) {
+        auto && l = v2::v2_dtl::operand(lhs);
+        auto && r = v2::v2_dtl::operand(rhs);
         if constexpr (v2::v2_dtl::base_3way<D1, D2>) {
-            return iterator_interface_access::base(lhs) <=> iterator_interface_access::base(rhs);
+            return iterator_interface_access::base(l) <=> iterator_interface_access::base(r);
           } else {
             using diff_type = typename D1::difference_type;
-            diff_type const diff = rhs - lhs;
+            diff_type const diff = r - l;
             return diff < diff_type(0) ? std::strong_ordering::less :
               diff_type(0) < diff ? std::strong_ordering::greater :
               std::strong_ordering::equal;
@@ -875,36 +1156,56 @@ BEMAN_ITERATOR_INTERFACE_DETAIL_STL_INTERFACES_NAMESPACE_V3 {
         }
 #endif
     template<typename D1, typename D2>
-      constexpr bool operator<(D1 lhs, D2 rhs)
-        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) < typename D1::difference_type(0); }
+      constexpr bool operator<(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2::v2_dtl::operand(lhs);
+          auto && r = v2::v2_dtl::operand(rhs);
+          return (l - r) < typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator<=(D1 lhs, D2 rhs)
-        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) <= typename D1::difference_type(0); }
+      constexpr bool operator<=(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2::v2_dtl::operand(lhs);
+          auto && r = v2::v2_dtl::operand(rhs);
+          return (l - r) <= typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator>(D1 lhs, D2 rhs)
-        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) > typename D1::difference_type(0); }
+      constexpr bool operator>(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2::v2_dtl::operand(lhs);
+          auto && r = v2::v2_dtl::operand(rhs);
+          return (l - r) > typename D1::difference_type(0);
+        }
     template<typename D1, typename D2>
-      constexpr bool operator>=(D1 lhs, D2 rhs)
-        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
-          { return (lhs - rhs) >= typename D1::difference_type(0); }
+      constexpr bool operator>=(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_iter_sub<D1, D2>())
+        requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2> {
+          auto && l = v2::v2_dtl::operand(lhs);
+          auto && r = v2::v2_dtl::operand(rhs);
+          return (l - r) >= typename D1::difference_type(0);
+        }
 
     template<typename D1, typename D2>
-      constexpr bool operator==(D1 lhs, D2 rhs)
+      constexpr bool operator==(D1 const & lhs, D2 const & rhs)
+        noexcept(v2::v2_dtl::nothrow_eq<D1, D2>())
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
                  detail::interoperable<D1, D2>::value &&
         (v2::v2_dtl::base_eq<D1, D2> || v2::v2_dtl::iter_sub<D1, D2>) {
+        auto && l = v2::v2_dtl::operand(lhs);
+        auto && r = v2::v2_dtl::operand(rhs);
         if constexpr (v2::v2_dtl::base_eq<D1, D2>) {
-          return (iterator_interface_access::base(lhs) == iterator_interface_access::base(rhs));
+          return (iterator_interface_access::base(l) == iterator_interface_access::base(r));
         } else if constexpr (v2::v2_dtl::iter_sub<D1, D2>) {
-          return (lhs - rhs) == typename D1::difference_type(0);
+          return (l - r) == typename D1::difference_type(0);
         }
       }
 
     template<typename D1, typename D2>
-      constexpr auto operator!=(D1 lhs, D2 rhs) -> decltype(!(lhs == rhs))
+      constexpr auto operator!=(D1 const & lhs, D2 const & rhs) noexcept(noexcept(!(lhs == rhs)))
+        -> decltype(!(lhs == rhs))
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2>
           { return !(lhs == rhs); }
 
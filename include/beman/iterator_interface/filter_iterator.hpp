@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/filter_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_FILTER_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_FILTER_ITERATOR_HPP
+
+#include <beman/iterator_interface/detail/block_search.hpp>
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+// Opt-in for predicates that may be evaluated on whole blocks of a contiguous
+// range of arithmetic values at once (see detail::block_find_if): they must be
+// cheap and free of side effects.
+template <class Pred>
+inline constexpr bool enable_block_search = false;
+
+// The predicate compare(element, value), e.g.
+// value_predicate(std::less<>(), 10) selects the elements less than 10.
+template <class Compare, class T>
+struct value_predicate {
+    [[no_unique_address]] Compare compare;
+    T                             value;
+
+    template <class U>
+    constexpr bool operator()(const U& element) const {
+        return static_cast<bool>(std::invoke(compare, element, value));
+    }
+};
+
+template <class Compare, class T>
+value_predicate(Compare, T) -> value_predicate<Compare, T>;
+
+template <class Compare, class T>
+    requires std::is_arithmetic_v<T> &&
+             (std::same_as<Compare, std::equal_to<>> || std::same_as<Compare, std::not_equal_to<>> ||
+              std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less_equal<>> ||
+              std::same_as<Compare, std::greater<>> || std::same_as<Compare, std::greater_equal<>>)
+inline constexpr bool enable_block_search<value_predicate<Compare, T>> = true;
+
+template <std::forward_iterator It, std::indirect_unary_predicate<It> Pred>
+    requires std::is_object_v<Pred>
+class filter_view;
+
+namespace detail {
+template <class It>
+using filter_value_t = std::conditional_t<std::is_reference_v<std::iter_reference_t<It>>,
+                                          std::remove_reference_t<std::iter_reference_t<It>>,
+                                          std::iter_value_t<It>>;
+
+template <class It>
+using filter_concept_t =
+    std::conditional_t<std::bidirectional_iterator<It>, std::bidirectional_iterator_tag, std::forward_iterator_tag>;
+} // namespace detail
+
+// The iterator of filter_view: the view holds the end of the underlying range
+// and the predicate, so that an iterator is just a pointer to its view and a
+// position.  Like std::ranges::filter_view, the iterators are invalidated when
+// the view is moved or destroyed.
+template <class It, class Pred>
+class filter_iterator : public ext_iterator_interface_compat<filter_iterator<It, Pred>,
+                                                             detail::filter_concept_t<It>,
+                                                             detail::filter_value_t<It>,
+                                                             std::iter_reference_t<It>,
+                                                             detail::filter_value_t<It>*,
+                                                             std::iter_difference_t<It>> {
+    using base_type = ext_iterator_interface_compat<filter_iterator<It, Pred>,
+                                                    detail::filter_concept_t<It>,
+                                                    detail::filter_value_t<It>,
+                                                    std::iter_reference_t<It>,
+                                                    detail::filter_value_t<It>*,
+                                                    std::iter_difference_t<It>>;
+
+  public:
+    filter_iterator() = default;
+    constexpr filter_iterator(const filter_view<It, Pred>& parent, It current)
+        : parent_(std::addressof(parent)), current_(std::move(current)) {}
+
+    constexpr const It& base() const& noexcept { return current_; }
+    constexpr It        base() && { return std::move(current_); }
+
+    constexpr std::iter_reference_t<It> operator*() const { return *current_; }
+
+    constexpr filter_iterator& operator++() {
+        current_ = parent_->find_next(std::next(current_));
+        return *this;
+    }
+
+    constexpr filter_iterator& operator--()
+        requires std::bidirectional_iterator<It>
+    {
+        do {
+            --current_;
+        } while (!std::invoke(parent_->pred_, *current_));
+        return *this;
+    }
+
+    using base_type::operator++;
+    using base_type::operator--;
+
+    friend constexpr bool operator==(const filter_iterator& lhs, const filter_iterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+  private:
+    friend iterator_interface_access;
+
+    // The split hook used by partition_range(): cuts the underlying range into
+    // n parts of equal length, and moves each cut forward to the next element
+    // that satisfies the predicate.  The parts cost the same to scan, however
+    // the matches are distributed.
+    template <class Out>
+        requires std::random_access_iterator<It>
+    constexpr Out split(const filter_iterator& last, std::iter_difference_t<It> n, Out out) const {
+        const std::iter_difference_t<It> size = last.current_ - current_;
+        It                               cut  = current_;
+        for (std::iter_difference_t<It> i = 0; i + 1 < n; ++i) {
+            cut += size / n + (i < size % n ? 1 : 0);
+            It next = parent_->find_next(cut);
+            if (last.current_ < next)
+                next = last.current_;
+            *out = filter_iterator(*parent_, std::move(next));
+            ++out;
+        }
+        return out;
+    }
+
+    const filter_view<It, Pred>* parent_ = nullptr;
+    It                           current_{};
+};
+
+// The elements of [first, last) that satisfy pred.  begin() searches for the
+// first of them on every call.
+template <std::forward_iterator It, std::indirect_unary_predicate<It> Pred>
+    requires std::is_object_v<Pred>
+class filter_view : public std::ranges::view_interface<filter_view<It, Pred>> {
+  public:
+    using iterator = filter_iterator<It, Pred>;
+
+    filter_view() = default;
+    constexpr filter_view(It first, It last, Pred pred)
+        : first_(std::move(first)), last_(std::move(last)), pred_(std::move(pred)) {}
+
+    constexpr iterator begin() const { return iterator(*this, find_next(first_)); }
+    constexpr iterator end() const { return iterator(*this, last_); }
+
+    constexpr const Pred& pred() const noexcept { return pred_; }
+
+  private:
+    friend iterator;
+
+    // The first position in [it, last_) that satisfies the predicate.
+    constexpr It find_next(It it) const {
+        if constexpr (std::contiguous_iterator<It> && enable_block_search<Pred> &&
+                      std::is_arithmetic_v<std::iter_value_t<It>>) {
+            const auto p = std::to_address(it);
+            const auto q = p + (last_ - it);
+            return it + (detail::block_find_if(p, q, pred_) - p);
+        } else {
+            return std::find_if(std::move(it), last_, std::cref(pred_));
+        }
+    }
+
+    It                         first_{};
+    It                         last_{};
+    [[no_unique_address]] Pred pred_{};
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -13,6 +13,8 @@
 #include <concepts>
 #include <type_traits>
 #include <iterator>
+#include <memory>
+#include <utility>
 
 namespace beman {
 namespace iterator_interface {
@@ -26,6 +28,7 @@ using std::is_object_v;
 using std::is_pointer_v;
 using std::is_reference_v;
 using std::is_same_v;
+using std::is_trivially_copyable_v;
 using std::output_iterator_tag;
 using std::ptrdiff_t;
 using std::remove_const_t;
@@ -42,6 +45,11 @@ class proxy_arrow_result {
   public:
     constexpr proxy_arrow_result(const T& value) noexcept(noexcept(T(value))) : value_(value) {}
     constexpr proxy_arrow_result(T&& value) noexcept(noexcept(T(std::move(value)))) : value_(std::move(value)) {}
+    // Initializes value_ directly from the prvalue f() returns, without a copy
+    // or move; used by iterator_interface::operator->.
+    template <class F>
+    constexpr proxy_arrow_result(std::in_place_t, F&& f) noexcept(noexcept(T(std::forward<F>(f)())))
+        : value_(std::forward<F>(f)()) {}
 
     constexpr const T* operator->() const noexcept { return &value_; }
     constexpr T*       operator->() noexcept { return &value_; }
@@ -55,59 +63,157 @@ template <class IteratorConcept,
           class DifferenceType = ptrdiff_t>
 class iterator_interface; // freestanding
 
+namespace detail {
+template <class IteratorConcept, class ValueType, class Reference, class Pointer, class DifferenceType>
+void derived_iterator(const iterator_interface<IteratorConcept, ValueType, Reference, Pointer, DifferenceType>&);
+} // namespace detail
+
+// Checked first by the free operators below.  They are found by ADL for every
+// type associated with this namespace, and failing on this cheap check avoids
+// instantiating the more expensive constraints that follow it.
+template <class D>
+concept derived_iter = requires(D d) { detail::derived_iterator(d); }; // exposition only
+
+// The comparison and difference operators below take iterators by const
+// reference, so that comparing iterators that carry predicates, buffers or
+// shared_ptrs copies nothing.  They work on a copy instead when it is free
+// (small and trivially copyable) or when base_reference() is not const.
+template <class D>
+concept copy_operand = // exposition only
+    (is_trivially_copyable_v<D> && sizeof(D) <= 2 * sizeof(void*)) ||
+    !requires(const D& d) { iterator_interface_access::base(d); };
+
+template <class D>
+using operand_t = conditional_t<copy_operand<D>, D, const D>; // exposition only
+
+namespace detail {
+template <class D>
+constexpr bool nothrow_operand() {
+    return !copy_operand<D> || std::is_nothrow_copy_constructible_v<D>;
+}
+
+template <class D>
+constexpr conditional_t<copy_operand<D>, D, const D&> operand(const D& d) noexcept(nothrow_operand<D>()) {
+    return d;
+}
+} // namespace detail
+
+template <class D1, class D2 = D1>
+concept base_iter_sub = // exposition only
+    requires(operand_t<D1>& d1, operand_t<D2>& d2) {
+        iterator_interface_access::base(d1) - iterator_interface_access::base(d2);
+    };
+
 template <class D1, class D2 = D1>
 concept base_iter_3way = // exposition only
-    requires(D1 d1, D2 d2) { iterator_interface_access::base(d1) <=> iterator_interface_access::base(d2); };
+    requires(operand_t<D1>& d1, operand_t<D2>& d2) {
+        iterator_interface_access::base(d1) <=> iterator_interface_access::base(d2);
+    };
 
 template <class D1, class D2 = D1>
-concept iter_sub = requires(D1 d1, D2 d2) { // exposition only
+concept iter_sub = requires(operand_t<D1>& d1, operand_t<D2>& d2) { // exposition only
     typename D1::difference_type;
     { d1 - d2 } -> convertible_to<typename D1::difference_type>;
 };
 
+// The exception specifications of the free operators below: each is
+// noexcept when the operations on the derived iterators (usually those of
+// base_reference()) that it is implemented with are.
+namespace detail {
+template <class D1, class D2>
+constexpr bool nothrow_operands() {
+    return nothrow_operand<D1>() && nothrow_operand<D2>();
+}
+
 template <class D>
-constexpr auto operator+(D it, typename D::difference_type n)
-    requires requires { it += n; }; // freestanding
+constexpr bool nothrow_advance() {
+    return std::is_nothrow_copy_constructible_v<D> &&
+           noexcept(std::declval<D&>() += std::declval<typename D::difference_type>());
+}
+
+template <class D1, class D2>
+constexpr bool nothrow_base_sub() {
+    return nothrow_operands<D1, D2>() &&
+           noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) -
+                    iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+}
+
+template <class D1, class D2>
+constexpr bool nothrow_iter_sub() {
+    return nothrow_operands<D1, D2>() && noexcept(std::declval<operand_t<D1>&>() - std::declval<operand_t<D2>&>());
+}
+
+template <class D1, class D2>
+constexpr bool nothrow_3way() {
+    if constexpr (base_iter_3way<D1, D2>) {
+        return nothrow_operands<D1, D2>() &&
+               noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) <=>
+                        iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+    } else {
+        return nothrow_iter_sub<D2, D1>();
+    }
+}
+} // namespace detail
 
 template <class D>
-constexpr auto operator+(typename D::difference_type n, D it)
-    requires requires { it += n; }; // freestanding
+constexpr auto operator+(D it, typename D::difference_type n) noexcept(detail::nothrow_advance<D>())
+    requires derived_iter<D> && requires { it += n; }; // freestanding
+
+template <class D>
+constexpr auto operator+(typename D::difference_type n, D it) noexcept(detail::nothrow_advance<D>())
+    requires derived_iter<D> && requires { it += n; }; // freestanding
 
 template <class D1, class D2>
-constexpr auto operator-(D1 lhs, D2 rhs) // freestanding
-    requires requires { iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); };
+constexpr auto operator-(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_base_sub<D1, D2>()) // freestanding
+    requires derived_iter<D1> && derived_iter<D2> && base_iter_sub<D1, D2>;
 
 template <class D>
-constexpr auto operator-(D it, typename D::difference_type n) // freestanding
-    requires requires { it += -n; };
+constexpr auto operator-(D it, typename D::difference_type n) noexcept(detail::nothrow_advance<D>()) // freestanding
+    requires derived_iter<D> && requires { it += -n; };
 
 template <class D1, class D2>
-constexpr auto operator<=>(D1 lhs, D2 rhs) // freestanding
-    requires base_iter_3way<D1, D2> || iter_sub<D1, D2>;
+constexpr auto operator<=>(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_3way<D1, D2>()) // freestanding
+    requires derived_iter<D1> && derived_iter<D2> && (base_iter_3way<D1, D2> || iter_sub<D1, D2>);
 
 template <class D1, class D2>
-constexpr bool operator<(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>; // freestanding
+constexpr bool operator<(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>; // freestanding
 
 template <class D1, class D2>
-constexpr bool operator<=(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>; // freestanding
+constexpr bool operator<=(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>; // freestanding
 
 template <class D1, class D2>
-constexpr bool operator>(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>; // freestanding
+constexpr bool operator>(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>; // freestanding
 
 template <class D1, class D2>
-constexpr bool operator>=(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>; // freestanding
+constexpr bool operator>=(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>; // freestanding
 
 template <class D1, class D2>
 concept base_iter_comparable = // exposition only
-    requires(D1 d1, D2 d2) { iterator_interface_access::base(d1) == iterator_interface_access::base(d2); };
+    requires(operand_t<D1>& d1, operand_t<D2>& d2) {
+        iterator_interface_access::base(d1) == iterator_interface_access::base(d2);
+    };
 
+namespace detail {
 template <class D1, class D2>
-constexpr bool operator==(D1 lhs, D2 rhs) // freestanding
-    requires(is_convertible_v<D2, D1> || is_convertible_v<D1, D2>) && (base_iter_comparable<D1, D2> || iter_sub<D1>);
+constexpr bool nothrow_eq() {
+    if constexpr (base_iter_comparable<D1, D2>) {
+        return nothrow_operands<D1, D2>() &&
+               noexcept(iterator_interface_access::base(std::declval<operand_t<D1>&>()) ==
+                        iterator_interface_access::base(std::declval<operand_t<D2>&>()));
+    } else {
+        return nothrow_iter_sub<D1, D2>();
+    }
+}
+} // namespace detail
+
+template <class D1, class D2>
+constexpr bool operator==(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_eq<D1, D2>()) // freestanding
+    requires derived_iter<D1> && derived_iter<D2> && (is_convertible_v<D2, D1> || is_convertible_v<D1, D2>) &&
+             (base_iter_comparable<D1, D2> || iter_sub<D1>);
 
 template <class IteratorConcept,
           class ValueType,
@@ -120,6 +226,20 @@ using proxy_iterator_interface = iterator_interface< // freestanding
     proxy_arrow_result<Reference>,
     DifferenceType>;
 
+template <class D>
+concept iter_arrow = requires(D& d) { iterator_interface_access::arrow(d); }; // exposition only
+
+template <class D>
+concept iter_move_hook = requires(const D& d) { iterator_interface_access::iter_move(d); }; // exposition only
+
+template <class D>
+concept iter_swap_hook = requires(const D& d) { iterator_interface_access::iter_swap(d, d); }; // exposition only
+
+template <class Pointer, class Reference>
+concept proxy_pointer = // exposition only
+    !is_reference_v<Reference> && (std::is_constructible_v<Pointer, std::in_place_t, Reference (*)()> ||
+                                   std::is_constructible_v<Pointer, Reference>);
+
 template <class Pointer, class Reference, class T>
     requires is_pointer_v<Pointer>
 decltype(auto) make_iterator_pointer(T&& value) // exposition only
@@ -133,6 +253,42 @@ auto make_iterator_pointer(T&& value) // exposition only
     return Pointer(std::forward<T>(value));
 }
 
+// Exception specifications of iterator_interface::operator->() and
+// operator[](), following the branches taken by their bodies.
+namespace detail {
+template <class Pointer, class Reference, class IteratorConcept, class S>
+constexpr bool nothrow_arrow() {
+    if constexpr (requires(S& s) { iterator_interface_access::to_address(s); }) {
+        return noexcept(iterator_interface_access::to_address(std::declval<S&>()));
+    } else if constexpr (iter_arrow<S>) {
+        return noexcept(iterator_interface_access::arrow(std::declval<S&>()));
+    } else if constexpr (std::derived_from<IteratorConcept, std::contiguous_iterator_tag> &&
+                         requires(S& s) { std::to_address(iterator_interface_access::base(s)); }) {
+        return noexcept(std::to_address(iterator_interface_access::base(std::declval<S&>())));
+    } else if constexpr (is_reference_v<Reference>) {
+        return noexcept(*std::declval<S&>()) &&
+               (is_pointer_v<Pointer> || std::is_nothrow_constructible_v<Pointer, Reference>);
+    } else if constexpr (std::is_constructible_v<Pointer, std::in_place_t, Reference (*)()>) {
+        return noexcept(*std::declval<S&>()) &&
+               std::is_nothrow_constructible_v<Pointer, std::in_place_t, Reference (*)() noexcept>;
+    } else {
+        return noexcept(Pointer(*std::declval<S&>()));
+    }
+}
+
+template <class S, class DifferenceType>
+constexpr bool nothrow_subscript() {
+    using D = std::remove_cvref_t<S>;
+    if constexpr (requires(D it, DifferenceType n) { it += n; }) {
+        return std::is_nothrow_copy_constructible_v<D> && noexcept(std::declval<D&>() += DifferenceType()) &&
+               noexcept(*std::declval<D&>());
+    } else {
+        return std::is_nothrow_copy_constructible_v<D> &&
+               noexcept(std::declval<D&>() = std::declval<D&>() + DifferenceType()) && noexcept(*std::declval<D&>());
+    }
+}
+} // namespace detail
+
 namespace detail {
 template <typename IteratorConcept, typename ReferenceType, bool IsForwardIter>
 struct iter_cat;
@@ -152,11 +308,22 @@ struct iter_cat<IteratorConcept, ReferenceType, true> {
                                               std::forward_iterator_tag>>>;
 };
 
+template <typename ReferenceType, bool IsContiguousIter>
+struct iter_element {};
+
+template <typename ReferenceType>
+struct iter_element<ReferenceType, true> {
+    using element_type = std::remove_reference_t<ReferenceType>;
+};
+
 } // namespace detail
 
 template <class IteratorConcept, class ValueType, class Reference, class Pointer, class DifferenceType>
 class iterator_interface
-    : detail::iter_cat<IteratorConcept, Reference, std::derived_from<IteratorConcept, std::forward_iterator_tag>> {
+    : public detail::iter_cat<IteratorConcept,
+                              Reference,
+                              std::derived_from<IteratorConcept, std::forward_iterator_tag>>,
+      public detail::iter_element<Reference, std::derived_from<IteratorConcept, std::contiguous_iterator_tag>> {
   public:
     using iterator_concept = IteratorConcept;
     using value_type       = remove_const_t<ValueType>;
@@ -164,40 +331,66 @@ class iterator_interface
     using pointer          = conditional_t<is_same_v<iterator_concept, output_iterator_tag>, void, Pointer>;
     using difference_type  = DifferenceType;
 
-    constexpr decltype(auto) operator*(this auto&& self)
+    constexpr decltype(auto) operator*(this auto&& self) noexcept(noexcept(*iterator_interface_access::base(self)))
         requires requires { *iterator_interface_access::base(self); }
     {
         return *iterator_interface_access::base(self);
     }
 
-    constexpr auto operator->(this auto&& self)
-        requires(!same_as<pointer, void>) && is_reference_v<reference> && requires { *self; }
+    constexpr auto operator->(this auto&& self) noexcept(
+        detail::nothrow_arrow<pointer, reference, IteratorConcept, std::remove_reference_t<decltype(self)>>())
+        requires(!same_as<pointer, void>) &&
+                (is_reference_v<reference> || proxy_pointer<pointer, reference> ||
+                 iter_arrow<std::remove_reference_t<decltype(self)>>) &&
+                requires { *self; }
     {
-        return make_iterator_pointer<pointer, reference>(*self);
+        if constexpr (requires { iterator_interface_access::to_address(self); }) {
+            return iterator_interface_access::to_address(self);
+        } else if constexpr (iter_arrow<std::remove_reference_t<decltype(self)>>) {
+            return iterator_interface_access::arrow(self);
+        } else if constexpr (std::derived_from<IteratorConcept, std::contiguous_iterator_tag> &&
+                             requires { std::to_address(iterator_interface_access::base(self)); }) {
+            // Never dereferences, so std::to_address() is valid on past-the-end iterators.
+            return std::to_address(iterator_interface_access::base(self));
+        } else if constexpr (is_reference_v<reference>) {
+            return make_iterator_pointer<pointer, reference>(*self);
+        } else if constexpr (std::is_constructible_v<pointer, std::in_place_t, reference (*)()>) {
+            // Guaranteed elision: *self initializes the proxy inside the result.
+            return pointer(std::in_place, [&self]() noexcept(noexcept(*self)) -> reference { return *self; });
+        } else {
+            return pointer(*self);
+        }
     }
 
-    constexpr decltype(auto) operator[](this const auto& self, difference_type n)
-        requires requires { self + n; }
+    constexpr decltype(auto) operator[](this const auto& self, difference_type n) noexcept(
+        detail::nothrow_subscript<decltype(self), difference_type>())
+        requires requires(std::remove_cvref_t<decltype(self)> it) { it += n; } || requires { self + n; }
     {
         auto retval = self;
-        retval      = retval + n;
+        // Advance in place where possible; retval + n would make a second copy.
+        if constexpr (requires { retval += n; })
+            retval += n;
+        else
+            retval = retval + n;
         return *retval;
     }
 
-    constexpr decltype(auto) operator++(this auto& self)
+    constexpr decltype(auto) operator++(this auto& self) noexcept(noexcept(++iterator_interface_access::base(self)))
         requires requires { ++iterator_interface_access::base(self); } && (!requires { self += difference_type(1); })
     {
         ++iterator_interface_access::base(self);
         return self;
     }
 
-    constexpr decltype(auto) operator++(this auto& self)
+    constexpr decltype(auto) operator++(this auto& self) noexcept(noexcept(self += difference_type(1)))
         requires requires { self += difference_type(1); }
     {
         return self += difference_type(1);
     }
 
-    constexpr auto operator++(this auto& self, int)
+    constexpr auto operator++(this auto& self, int) noexcept(
+        noexcept(++self) && (is_same_v<IteratorConcept, input_iterator_tag> ||
+                             std::is_nothrow_copy_constructible_v<std::remove_cvref_t<decltype(self)>>))
         requires requires { ++self; }
     {
         if constexpr (is_same_v<IteratorConcept, input_iterator_tag>) {
@@ -209,27 +402,29 @@ class iterator_interface
         }
     }
 
-    constexpr decltype(auto) operator+=(this auto& self, difference_type n)
+    constexpr decltype(auto) operator+=(this auto& self, difference_type n) noexcept(
+        noexcept(iterator_interface_access::base(self) += n))
         requires requires { iterator_interface_access::base(self) += n; }
     {
         iterator_interface_access::base(self) += n;
         return self;
     }
 
-    constexpr decltype(auto) operator--(this auto& self)
+    constexpr decltype(auto) operator--(this auto& self) noexcept(noexcept(--iterator_interface_access::base(self)))
         requires requires { --iterator_interface_access::base(self); } && (!requires { self += difference_type(1); })
     {
         --iterator_interface_access::base(self);
         return self;
     }
 
-    constexpr decltype(auto) operator--(this auto& self)
+    constexpr decltype(auto) operator--(this auto& self) noexcept(noexcept(self += -difference_type(1)))
         requires requires { self += -difference_type(1); }
     {
         return self += -difference_type(1);
     }
 
-    constexpr auto operator--(this auto& self, int)
+    constexpr auto operator--(this auto& self, int) noexcept(
+        noexcept(--self) && std::is_nothrow_copy_constructible_v<std::remove_cvref_t<decltype(self)>>)
         requires requires { --self; }
     {
         auto retval = self;
@@ -237,50 +432,68 @@ class iterator_interface
         return retval;
     }
 
-    constexpr decltype(auto) operator-=(this auto& self, difference_type n)
+    constexpr decltype(auto) operator-=(this auto& self, difference_type n) noexcept(noexcept(self += -n))
         requires requires { self += -n; }
     {
         return self += -n;
     }
+
+    template <class D>
+        requires std::derived_from<D, iterator_interface> && iter_move_hook<D>
+    friend constexpr decltype(auto) iter_move(const D& it) noexcept(
+        noexcept(iterator_interface_access::iter_move(it))) {
+        return iterator_interface_access::iter_move(it);
+    }
+
+    template <class D>
+        requires std::derived_from<D, iterator_interface> && iter_swap_hook<D>
+    friend constexpr void iter_swap(const D& lhs, const D& rhs) noexcept(
+        noexcept(iterator_interface_access::iter_swap(lhs, rhs))) {
+        iterator_interface_access::iter_swap(lhs, rhs);
+    }
 };
 
 template <class D>
-constexpr auto operator+(D it, typename D::difference_type n)
-    requires requires { it += n; }
+constexpr auto operator+(D it, typename D::difference_type n) noexcept(detail::nothrow_advance<D>())
+    requires derived_iter<D> && requires { it += n; }
 {
     return it += n;
 }
 
 template <class D>
-constexpr auto operator+(typename D::difference_type n, D it)
-    requires requires { it += n; }
+constexpr auto operator+(typename D::difference_type n, D it) noexcept(detail::nothrow_advance<D>())
+    requires derived_iter<D> && requires { it += n; }
 {
     return it += n;
 }
 
 template <class D1, class D2>
-constexpr auto operator-(D1 lhs, D2 rhs)
-    requires requires { iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs); }
+constexpr auto operator-(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_base_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && base_iter_sub<D1, D2>
 {
-    return iterator_interface_access::base(lhs) - iterator_interface_access::base(rhs);
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
+    return iterator_interface_access::base(l) - iterator_interface_access::base(r);
 }
 
 template <class D>
-constexpr auto operator-(D it, typename D::difference_type n)
-    requires requires { it += -n; }
+constexpr auto operator-(D it, typename D::difference_type n) noexcept(detail::nothrow_advance<D>())
+    requires derived_iter<D> && requires { it += -n; }
 {
     return it += -n;
 }
 
 template <class D1, class D2>
-constexpr auto operator<=>(D1 lhs, D2 rhs)
-    requires base_iter_3way<D1, D2> || iter_sub<D1, D2>
+constexpr auto operator<=>(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_3way<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && (base_iter_3way<D1, D2> || iter_sub<D1, D2>)
 {
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
     if constexpr (base_iter_3way<D1, D2>) {
-        return iterator_interface_access::base(lhs) <=> iterator_interface_access::base(rhs);
+        return iterator_interface_access::base(l) <=> iterator_interface_access::base(r);
     } else {
         using diff_type      = typename D1::difference_type;
-        const diff_type diff = rhs - lhs;
+        const diff_type diff = r - l;
         return diff < diff_type(0)   ? strong_ordering::less
                : diff_type(0) < diff ? strong_ordering::greater
                                      : strong_ordering::equal;
@@ -288,41 +501,52 @@ constexpr auto operator<=>(D1 lhs, D2 rhs)
 }
 
 template <class D1, class D2>
-constexpr bool operator<(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>
+constexpr bool operator<(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>
 {
-    return (lhs - rhs) < typename D1::difference_type(0);
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
+    return (l - r) < typename D1::difference_type(0);
 }
 
 template <class D1, class D2>
-constexpr bool operator<=(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>
+constexpr bool operator<=(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>
 {
-    return (lhs - rhs) <= typename D1::difference_type(0);
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
+    return (l - r) <= typename D1::difference_type(0);
 }
 
 template <class D1, class D2>
-constexpr bool operator>(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>
+constexpr bool operator>(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>
 {
-    return (lhs - rhs) > typename D1::difference_type(0);
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
+    return (l - r) > typename D1::difference_type(0);
 }
 
 template <class D1, class D2>
-constexpr bool operator>=(D1 lhs, D2 rhs)
-    requires iter_sub<D1, D2>
+constexpr bool operator>=(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_iter_sub<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && iter_sub<D1, D2>
 {
-    return (lhs - rhs) >= typename D1::difference_type(0);
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
+    return (l - r) >= typename D1::difference_type(0);
 }
 
 template <class D1, class D2>
-constexpr bool operator==(D1 lhs, D2 rhs)
-    requires(is_convertible_v<D2, D1> || is_convertible_v<D1, D2>) && (base_iter_comparable<D1, D2> || iter_sub<D1>)
+constexpr bool operator==(const D1& lhs, const D2& rhs) noexcept(detail::nothrow_eq<D1, D2>())
+    requires derived_iter<D1> && derived_iter<D2> && (is_convertible_v<D2, D1> || is_convertible_v<D1, D2>) &&
+             (base_iter_comparable<D1, D2> || iter_sub<D1>)
 {
+    auto&& l = detail::operand(lhs);
+    auto&& r = detail::operand(rhs);
     if constexpr (base_iter_comparable<D1, D2>) {
-        return iterator_interface_access::base(lhs) == iterator_interface_access::base(rhs);
+        return iterator_interface_access::base(l) == iterator_interface_access::base(r);
     } else if constexpr (iter_sub<D1>) {
-        return (lhs - rhs) == typename D1::difference_type(0);
+        return (l - r) == typename D1::difference_type(0);
     }
 }
 
@@ -335,6 +559,14 @@ template <typename Derived,
 using ext_iterator_interface_compat =
     iterator_interface<IteratorConcept, ValueType, Reference, Pointer, DifferenceType>;
 
+template <typename Derived,
+          typename IteratorConcept,
+          typename ValueType,
+          typename Reference      = ValueType,
+          typename DifferenceType = std::ptrdiff_t>
+using ext_proxy_iterator_interface_compat =
+    proxy_iterator_interface<IteratorConcept, ValueType, Reference, DifferenceType>;
+
 #else
 
 namespace detail {
@@ -364,6 +596,16 @@ template <typename Derived,
 using ext_iterator_interface_compat = detail::stl_interfaces::
     iterator_interface<Derived, IteratorConcept, ValueType, Reference, Pointer, DifferenceType>;
 
+using detail::stl_interfaces::proxy_arrow_result;
+
+template <typename Derived,
+          typename IteratorConcept,
+          typename ValueType,
+          typename Reference      = ValueType,
+          typename DifferenceType = std::ptrdiff_t>
+using ext_proxy_iterator_interface_compat =
+    detail::stl_interfaces::proxy_iterator_interface<Derived, IteratorConcept, ValueType, Reference, DifferenceType>;
+
 #endif
 
 } // namespace iterator_interface
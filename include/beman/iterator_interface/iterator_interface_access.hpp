@@ -4,6 +4,8 @@
 #ifndef ITERATOR_INTERFACE_ACCESSS_HPP
 #define ITERATOR_INTERFACE_ACCESSS_HPP
 
+#include <utility>
+
 namespace beman {
 namespace iterator_interface {
 // [iterator.interface], iterator interface
@@ -20,6 +22,131 @@ struct iterator_interface_access {
     static constexpr auto base(const D& d) noexcept -> decltype(d.base_reference()) {
         return d.base_reference();
     }
+
+    // Address of the referenced element of a contiguous iterator, which must be
+    // valid for past-the-end iterators too (see std::to_address).
+    template <typename D>
+    static constexpr auto to_address(const D& d) noexcept(noexcept(d.to_address())) -> decltype(d.to_address()) {
+        return d.to_address();
+    }
+
+    // Result of operator-> for iterators that supply their own, e.g. a proxy
+    // iterator returning a pointer-like view of its element.
+    template <typename D>
+    static constexpr auto arrow(D& d) noexcept(noexcept(d.arrow())) -> decltype(d.arrow()) {
+        return d.arrow();
+    }
+
+    // Customizations of std::ranges::iter_move and std::ranges::iter_swap,
+    // which iterator_interface exposes as hidden friends.  iter_move(d)
+    // returns the element as an rvalue, e.g. a proxy holding rvalue references
+    // for a proxy iterator, whose default iter_move would return the proxy
+    // itself and so copy instead of move.  iter_swap(d1, d2) exchanges the two
+    // elements.
+    template <typename D>
+    static constexpr auto iter_move(const D& d) noexcept(noexcept(d.iter_move())) -> decltype(d.iter_move()) {
+        return d.iter_move();
+    }
+
+    template <typename D1, typename D2>
+    static constexpr auto iter_swap(const D1& d1, const D2& d2) noexcept(noexcept(d1.iter_swap(d2)))
+        -> decltype(d1.iter_swap(d2)) {
+        return d1.iter_swap(d2);
+    }
+
+    // Bulk transfer.  read_n(d, out, n) copies the n elements starting at d to
+    // out, advances d past them and returns the end of the output.
+    // write_n(d, in, n) assigns the n elements starting at in to the n elements
+    // starting at d, advances d past them and returns the end of the input.
+    template <typename D, typename O, typename N>
+    static constexpr auto read_n(D& d, O out, N n) noexcept(noexcept(d.read_n(std::move(out), n)))
+        -> decltype(d.read_n(std::move(out), n)) {
+        return d.read_n(std::move(out), n);
+    }
+
+    template <typename D, typename I, typename N>
+    static constexpr auto write_n(D& d, I in, N n) noexcept(noexcept(d.write_n(std::move(in), n)))
+        -> decltype(d.write_n(std::move(in), n)) {
+        return d.write_n(std::move(in), n);
+    }
+
+    // Partitioning.  split(first, last, n, out) writes the n - 1 boundaries
+    // that cut [first, last) into n parts of about equal cost to out, in
+    // order, and returns the end of the output.  Used by partition_range()
+    // for iterators that can find them without walking the range.
+    template <typename D, typename N, typename O>
+    static constexpr auto split(const D& first, const D& last, N n, O out) noexcept(
+        noexcept(first.split(last, n, std::move(out)))) -> decltype(first.split(last, n, std::move(out))) {
+        return first.split(last, n, std::move(out));
+    }
+
+    // Whole-range algorithms.  find(first, last, value), count(first, last,
+    // value), fill(first, last, value), equal(first1, last1, first2) and
+    // transform(first, last, out, op) do what the algorithm.hpp functions of
+    // the same names do, for iterators that can process many elements per
+    // step, e.g. a word of packed bits at a time, or that have a tighter loop
+    // than their increment and dereference, e.g. an indexed loop over a
+    // pointer.
+    template <typename D, typename T>
+    static constexpr auto find(const D& first, const D& last, const T& value) noexcept(
+        noexcept(first.find(last, value))) -> decltype(first.find(last, value)) {
+        return first.find(last, value);
+    }
+
+    template <typename D, typename T>
+    static constexpr auto count(const D& first, const D& last, const T& value) noexcept(
+        noexcept(first.count(last, value))) -> decltype(first.count(last, value)) {
+        return first.count(last, value);
+    }
+
+    template <typename D, typename T>
+    static constexpr auto fill(const D& first, const D& last, const T& value) noexcept(
+        noexcept(first.fill(last, value))) -> decltype(first.fill(last, value)) {
+        return first.fill(last, value);
+    }
+
+    template <typename D1, typename D2>
+    static constexpr auto equal(const D1& first1, const D1& last1, const D2& first2) noexcept(
+        noexcept(first1.equal(last1, first2))) -> decltype(first1.equal(last1, first2)) {
+        return first1.equal(last1, first2);
+    }
+
+    template <typename D, typename O, typename F>
+    static constexpr auto transform(const D& first, const D& last, O out, F& op) noexcept(
+        noexcept(first.transform(last, std::move(out), op))) -> decltype(first.transform(last, std::move(out), op)) {
+        return first.transform(last, std::move(out), op);
+    }
+
+    // Segmented iterator protocol.  A segmented iterator D exposes the segment
+    // it currently points into and a contiguous iterator local to that segment,
+    // and can be rebuilt from such a pair.
+    template <typename D>
+    static constexpr auto segment(const D& d) noexcept(noexcept(d.segment())) -> decltype(d.segment()) {
+        return d.segment();
+    }
+
+    template <typename D>
+    static constexpr auto local(const D& d) noexcept(noexcept(d.local())) -> decltype(d.local()) {
+        return d.local();
+    }
+
+    template <typename D, typename S>
+    static constexpr auto segment_begin(const S& s) noexcept(noexcept(D::segment_begin(s)))
+        -> decltype(D::segment_begin(s)) {
+        return D::segment_begin(s);
+    }
+
+    template <typename D, typename S>
+    static constexpr auto segment_end(const S& s) noexcept(noexcept(D::segment_end(s)))
+        -> decltype(D::segment_end(s)) {
+        return D::segment_end(s);
+    }
+
+    template <typename D, typename S, typename L>
+    static constexpr auto compose(const S& s, const L& l) noexcept(noexcept(D::compose(s, l)))
+        -> decltype(D::compose(s, l)) {
+        return D::compose(s, l);
+    }
 };
 } // namespace iterator_interface
 } // namespace beman
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/leb128_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_LEB128_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_LEB128_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+// Writes value to out as unsigned LEB128: seven bits per byte, least
+// significant first, with the high bit of every byte but the last set.
+template <std::unsigned_integral T, std::output_iterator<std::byte> Out>
+constexpr Out leb128_encode(T value, Out out) {
+    while (value >= 0x80) {
+        *out = static_cast<std::byte>(static_cast<unsigned char>(value | 0x80));
+        ++out;
+        value >>= 7;
+    }
+    *out = static_cast<std::byte>(static_cast<unsigned char>(value));
+    ++out;
+    return out;
+}
+
+namespace detail {
+// Packs the seven payload bits of the bytes of each lane of the little-endian
+// word w, lanes being 2 or 4 bytes wide, into the low bits of the lane.
+constexpr std::uint64_t leb128_pack(std::uint64_t w, int lane) noexcept {
+    std::uint64_t x = (w & 0x007f007f007f007f) | ((w & 0x7f007f007f007f00) >> 1);
+    if (lane >= 4)
+        x = (x & 0x00003fff00003fff) | ((x & 0x3fff00003fff0000) >> 2);
+    if (lane == 8)
+        x = (x & 0x000000000fffffff) | ((x & 0x0fffffff00000000) >> 4);
+    return x;
+}
+
+// Decodes one value from [p, last) to *out one byte at a time; returns the
+// end of its bytes, or nullptr when it is truncated.  The bytes that may hold
+// bits of T are read without bounds checks when they are all in the range.
+template <class T>
+constexpr const std::byte* leb128_decode_one(const std::byte* p, const std::byte* last, T* out) noexcept {
+    constexpr std::ptrdiff_t max_bytes = (std::numeric_limits<T>::digits + 6) / 7;
+
+    if (p != last && static_cast<unsigned char>(*p) < 0x80) {
+        *out = static_cast<T>(*p);
+        return p + 1;
+    }
+    T              value = 0;
+    std::ptrdiff_t k     = 0;
+    if (last - p >= max_bytes) {
+        for (; k != max_bytes; ++k) {
+            const auto b = static_cast<unsigned char>(p[k]);
+            value |= static_cast<T>(static_cast<T>(b & 0x7f) << (7 * k));
+            if (b < 0x80) {
+                *out = value;
+                return p + k + 1;
+            }
+        }
+    }
+    for (; k != last - p; ++k) {
+        const auto b = static_cast<unsigned char>(p[k]);
+        if (k < max_bytes)
+            value |= static_cast<T>(static_cast<T>(b & 0x7f) << (7 * k));
+        if (b < 0x80) {
+            *out = value;
+            return p + k + 1;
+        }
+    }
+    return nullptr;
+}
+
+// Decodes up to n values from [first, last) to out and advances first past
+// them; returns the number of values decoded.  Sixteen bytes are loaded at a
+// time and their high bits, which end the values, pick how they are decoded.
+// When they are all clear, as in runs of small gaps of posting lists, the
+// bytes are sixteen values of one byte, which a loop the compiler vectorizes
+// widens to Ts.  When they say that the bytes start with values of two bytes
+// (eight or four of them), two of four bytes or three of five, these are
+// decoded together without branches, the payload bits of their bytes being
+// packed within 64-bit words.  Otherwise the next eight values are decoded
+// one byte at a time, which branch prediction handles well when their lengths
+// vary little.
+template <class T>
+constexpr std::size_t
+leb128_decode(const std::byte*& first, const std::byte* last, T* out, std::size_t n) noexcept {
+    constexpr std::uint64_t high = 0x8080808080808080;
+
+    const std::byte* p = first;
+    std::size_t      i = 0;
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+        while (n - i >= 16 && last - p >= 16) {
+            std::uint64_t w[2];
+            std::memcpy(w, p, sizeof(w));
+            if (((w[0] | w[1]) & high) == 0) {
+                unsigned char b[16];
+                std::memcpy(b, p, sizeof(b));
+                for (std::size_t k = 0; k != 16; ++k)
+                    out[i + k] = static_cast<T>(b[k]);
+                p += 16;
+                i += 16;
+                continue;
+            }
+            constexpr std::uint64_t two = 0x8000800080008000;
+            const std::uint64_t     ends = ~w[0] & high;
+            if (ends == two) {
+                const std::uint64_t x[2] = {leb128_pack(w[0], 2), leb128_pack(w[1], 2)};
+                std::uint16_t       v[8];
+                std::memcpy(v, x, sizeof(v));
+                const std::size_t m = (~w[1] & high) == two ? 8 : 4;
+                for (std::size_t k = 0; k != m; ++k)
+                    out[i + k] = static_cast<T>(v[k]);
+                p += 2 * m;
+                i += m;
+                continue;
+            }
+            if (ends == 0x8000000080000000) {
+                const std::uint64_t x = leb128_pack(w[0], 4);
+                out[i]                = static_cast<T>(x & 0xffffffff);
+                out[i + 1]            = static_cast<T>(x >> 32);
+                p += 8;
+                i += 2;
+                continue;
+            }
+            if (ends == 0x0000008000000000 && (~w[1] & high & 0x00ffffffffffffff) == 0x0080000000008000) {
+                std::uint64_t x[3];
+                std::memcpy(&x[0], p, sizeof(x[0]));
+                std::memcpy(&x[1], p + 5, sizeof(x[1]));
+                std::memcpy(&x[2], p + 8, sizeof(x[2]));
+                x[2] >>= 16;
+                for (std::size_t k = 0; k != 3; ++k)
+                    out[i + k] = static_cast<T>(leb128_pack(x[k] & 0xffffffffff, 8));
+                p += 15;
+                i += 3;
+                continue;
+            }
+            for (const std::size_t stop = i + 8; i != stop && p != last; ++i) {
+                p = leb128_decode_one(p, last, out + i);
+                if (p == nullptr) {
+                    first = last;
+                    return i;
+                }
+            }
+        }
+    }
+    for (; i != n && p != last; ++i) {
+        p = leb128_decode_one(p, last, out + i);
+        if (p == nullptr) {
+            first = last;
+            return i;
+        }
+    }
+    first = p;
+    return i;
+}
+} // namespace detail
+
+// Decodes unsigned LEB128 values from the front of bytes to out until out is
+// full or bytes is used up, and drops their bytes from bytes; returns the
+// number of values decoded.  leb128_view decodes its blocks with it (see
+// detail::leb128_decode).  Bits of a value beyond those of T are discarded,
+// and a truncated value at the end of bytes is dropped without being decoded.
+template <std::unsigned_integral T, std::size_t Extent>
+constexpr std::size_t leb128_decode(std::span<const std::byte>& bytes, std::span<T, Extent> out) noexcept {
+    const std::byte*  first = bytes.data();
+    const std::byte*  last  = first + bytes.size();
+    const std::size_t n     = detail::leb128_decode(first, last, out.data(), out.size());
+    bytes                   = std::span<const std::byte>(first, last);
+    return n;
+}
+
+template <std::unsigned_integral T, bool Delta = false>
+class leb128_view;
+
+// The iterator of leb128_view: an input iterator over the values decoded into
+// the view's buffer, holding the bounds of the decoded values so that
+// dereferencing, incrementing and comparing to std::default_sentinel touch
+// no other state.  Incrementing past the last decoded value has the view
+// decode the next block, out of the way of the usual increment.  Like
+// std::istream_iterator, all the iterators of a view share its position.
+template <std::unsigned_integral T, bool Delta>
+class leb128_iterator
+    : public ext_iterator_interface_compat<leb128_iterator<T, Delta>, std::input_iterator_tag, const T, const T&> {
+  public:
+    leb128_iterator() = default;
+    constexpr explicit leb128_iterator(leb128_view<T, Delta>& parent) noexcept
+        : parent_(std::addressof(parent)), current_(parent.buffer_.data()), last_(current_ + parent.decode()) {
+        if constexpr (Delta)
+            sum_ = *current_;
+    }
+
+    constexpr const T& operator*() const noexcept {
+        if constexpr (Delta)
+            return sum_;
+        else
+            return *current_;
+    }
+
+    constexpr leb128_iterator& operator++() noexcept {
+        if (++current_ == last_) {
+            current_ = parent_->buffer_.data();
+            last_    = current_ + parent_->decode();
+        }
+        // At the end, current_ points to a stale value in the buffer.
+        if constexpr (Delta)
+            sum_ += *current_;
+        return *this;
+    }
+
+    constexpr void operator++(int) noexcept { ++*this; }
+
+    friend constexpr bool operator==(const leb128_iterator& it, std::default_sentinel_t) noexcept {
+        return it.current_ == it.last_;
+    }
+
+  private:
+    leb128_view<T, Delta>* parent_  = nullptr;
+    const T*               current_ = nullptr;
+    const T*               last_    = nullptr;
+    // With Delta, the running sum of the values up to current_.
+    T sum_ = 0;
+};
+
+// The unsigned LEB128 values encoded in a sequence of bytes, e.g. a posting
+// list or a column chunk, as an input range of Ts.  With Delta, the encoded
+// values are the differences between consecutive values, the first being the
+// first value, and the range yields their running sums, e.g. sorted ids.
+//
+// Values are decoded block values at a time into a buffer in the view with
+// leb128_decode, and the iterators add up the deltas as they advance.  Bits of a
+// value beyond those of T are discarded, and a truncated value at the end of
+// the bytes is ignored.  Like filter_view, the iterators point to the view,
+// so they are invalidated when it is moved or destroyed; begin() starts over
+// from the first value.
+template <std::unsigned_integral T, bool Delta>
+class leb128_view : public std::ranges::view_interface<leb128_view<T, Delta>> {
+  public:
+    using iterator = leb128_iterator<T, Delta>;
+
+    // Number of values decoded at a time.
+    static constexpr std::size_t block = 128;
+
+    leb128_view() = default;
+    constexpr explicit leb128_view(std::span<const std::byte> bytes) noexcept : bytes_(bytes) {}
+
+    constexpr iterator begin() noexcept {
+        rest_ = bytes_;
+        return iterator(*this);
+    }
+
+    constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    constexpr std::span<const std::byte> bytes() const noexcept { return bytes_; }
+
+  private:
+    friend iterator;
+
+    // Decodes the next block to buffer_; returns the number of values.
+    constexpr std::size_t decode() noexcept { return leb128_decode(rest_, std::span(buffer_)); }
+
+    std::span<const std::byte> bytes_;
+    std::span<const std::byte> rest_;
+    std::array<T, block>       buffer_{};
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/line_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_LINE_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_LINE_ITERATOR_HPP
+
+#include <beman/iterator_interface/detail/block_search.hpp>
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+namespace beman {
+namespace iterator_interface {
+
+// A forward iterator over the lines of a text held in memory, e.g. a mapped
+// file, as string_views into it.  Lines end at '\n', which is not part of
+// them (a '\r' before it is); the text after the last '\n' is a last line if
+// it is not empty, as with std::getline.
+//
+// Newlines are found 64 bytes at a time (see detail::block_match_mask): the
+// iterator keeps the mask of the newlines ahead of it in the current block, so
+// that each byte is compared once however short the lines are.  The end of
+// the text is reached when the next line would start there, which comparing
+// to std::default_sentinel checks without computing any length.
+class line_iterator : public ext_proxy_iterator_interface_compat<line_iterator,
+                                                                 std::forward_iterator_tag,
+                                                                 std::string_view,
+                                                                 std::string_view> {
+    using base_type = ext_proxy_iterator_interface_compat<line_iterator,
+                                                          std::forward_iterator_tag,
+                                                          std::string_view,
+                                                          std::string_view>;
+
+  public:
+    line_iterator() = default;
+
+    // The first line of text.
+    constexpr explicit line_iterator(std::string_view text) noexcept
+        : line_(text.data()), last_(text.data() + text.size()), block_(text.data()), next_(text.data()) {
+        find_eol();
+    }
+
+    constexpr std::string_view operator*() const noexcept {
+        return std::string_view(line_, static_cast<std::size_t>(eol_ - line_));
+    }
+
+    constexpr line_iterator& operator++() noexcept {
+        if (eol_ == last_) {
+            line_ = last_;
+        } else {
+            line_ = eol_ + 1;
+            find_eol();
+        }
+        return *this;
+    }
+
+    using base_type::operator++;
+
+    friend constexpr bool operator==(const line_iterator& lhs, const line_iterator& rhs) noexcept {
+        return lhs.line_ == rhs.line_;
+    }
+
+    friend constexpr bool operator==(const line_iterator& it, std::default_sentinel_t) noexcept {
+        return it.line_ == it.last_;
+    }
+
+  private:
+    // Sets eol_ to the first newline at or after line_, or to last_.
+    constexpr void find_eol() noexcept {
+        while (mask_ == 0) {
+            if (next_ == last_) {
+                eol_ = last_;
+                return;
+            }
+            block_ = next_;
+            if (last_ - next_ >= 64) {
+                mask_ = detail::block_match_mask(next_, '\n');
+                next_ += 64;
+            } else {
+                for (std::ptrdiff_t i = 0; i != last_ - next_; ++i)
+                    mask_ |= std::uint64_t(next_[i] == '\n') << i;
+                next_ = last_;
+            }
+        }
+        eol_ = block_ + std::countr_zero(mask_);
+        mask_ &= mask_ - 1;
+    }
+
+    // mask_ holds the newlines after eol_ in the block starting at block_, and
+    // next_ is the start of the next block to scan.
+    const char*   line_  = nullptr;
+    const char*   eol_   = nullptr;
+    const char*   last_  = nullptr;
+    const char*   block_ = nullptr;
+    const char*   next_  = nullptr;
+    std::uint64_t mask_  = 0;
+};
+
+// The lines of text, as a range of line_iterators.
+constexpr std::ranges::subrange<line_iterator, std::default_sentinel_t> lines(std::string_view text) noexcept {
+    return {line_iterator(text), std::default_sentinel};
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
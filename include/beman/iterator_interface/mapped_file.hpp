@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/mapped_file.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_MAPPED_FILE_HPP
+#define BEMAN_ITERATOR_INTERFACE_MAPPED_FILE_HPP
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && \
+    __has_include(<unistd.h>)
+    #define BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE() 1
+#else
+    #define BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE() 0
+#endif
+
+#if BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE()
+
+    #include <beman/iterator_interface/iterator_interface.hpp>
+
+    #include <algorithm>
+    #include <cerrno>
+    #include <cstddef>
+    #include <cstdint>
+    #include <iterator>
+    #include <memory>
+    #include <ranges>
+    #include <system_error>
+    #include <type_traits>
+    #include <utility>
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+namespace beman {
+namespace iterator_interface {
+
+// A read-only, private mapping of a whole file, unmapped on destruction.
+// Throws std::system_error when the file cannot be opened or mapped.
+class mapped_file {
+  public:
+    enum class advice { normal, sequential, random, willneed, dontneed };
+
+    mapped_file() = default;
+
+    explicit mapped_file(const char* path) {
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "open");
+        struct ::stat st;
+        if (::fstat(fd, &st) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat");
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ != 0) {
+            void* const p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "mmap");
+            }
+            data_ = static_cast<const std::byte*>(p);
+        }
+        ::close(fd);
+    }
+
+    mapped_file(mapped_file&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        mapped_file(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~mapped_file() {
+        if (data_)
+            ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+
+    void swap(mapped_file& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    const std::byte* data() const noexcept { return data_; }
+    std::size_t      size() const noexcept { return size_; }
+
+    // Passes a hint about the bytes [offset, offset + length), clipped to the
+    // file and widened to whole pages, to madvise.  Hints that the system
+    // rejects are ignored.
+    void advise(std::size_t offset, std::size_t length, advice a) const noexcept {
+        if (offset >= size_)
+            return;
+        length                   = std::min(length, size_ - offset);
+        static const auto page   = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t first  = offset / page * page;
+        const std::size_t last   = offset + length;
+        void* const       region = const_cast<std::byte*>(data_ + first);
+        (void)::madvise(region, last - first, native(a));
+    }
+
+    void advise(advice a) const noexcept { advise(0, size_, a); }
+
+  private:
+    static int native(advice a) noexcept {
+        switch (a) {
+        case advice::sequential:
+            return MADV_SEQUENTIAL;
+        case advice::random:
+            return MADV_RANDOM;
+        case advice::willneed:
+            return MADV_WILLNEED;
+        case advice::dontneed:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+        }
+    }
+
+    const std::byte* data_ = nullptr;
+    std::size_t      size_ = 0;
+};
+
+template <class Record>
+    requires std::is_trivially_copyable_v<Record>
+class mapped_records;
+
+// The iterator of mapped_records: a random access iterator whose dereference
+// is a reference to the record in the mapping, without copying.
+//
+// Once it has stepped mapped_records::sustained_steps times in one direction,
+// the iterator asks the kernel to read ahead in the direction of travel:
+// crossing into a new window of mapped_records::window bytes issues
+// MADV_WILLNEED for the next window, after it when moving forward and before
+// it when moving backward, which the kernel's own readahead does not cover.
+// Increments and decrements only count and compare against the window
+// bounds.  Jumps, as in a binary search, make no system call and start the
+// count over, so that the single steps between the jumps of std::lower_bound
+// issue no hint either.
+template <class Record>
+class record_iterator
+    : public ext_iterator_interface_compat<record_iterator<Record>, std::random_access_iterator_tag, const Record> {
+    using base_type =
+        ext_iterator_interface_compat<record_iterator<Record>, std::random_access_iterator_tag, const Record>;
+
+  public:
+    using typename base_type::difference_type;
+
+    record_iterator() = default;
+    constexpr record_iterator(const mapped_records<Record>& parent, difference_type pos) noexcept
+        : parent_(std::addressof(parent)), pos_(pos), lo_(pos), hi_(pos) {}
+
+    const Record& operator*() const noexcept { return parent_->records_[pos_]; }
+
+    record_iterator& operator++() noexcept {
+        ++pos_;
+        steps_ = steps_ > 0 ? std::min(steps_ + 1, sustained) : 1;
+        if (steps_ == sustained && pos_ >= hi_)
+            hint(1);
+        return *this;
+    }
+
+    record_iterator& operator--() noexcept {
+        --pos_;
+        steps_ = steps_ < 0 ? std::max(steps_ - 1, -sustained) : -1;
+        if (steps_ == -sustained && pos_ < lo_)
+            hint(-1);
+        return *this;
+    }
+
+    using base_type::operator++;
+    using base_type::operator--;
+
+    record_iterator& operator+=(difference_type n) noexcept {
+        pos_ += n;
+        lo_    = hi_ = pos_;
+        steps_ = 0;
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const record_iterator& lhs, const record_iterator& rhs) noexcept {
+        return lhs.pos_ - rhs.pos_;
+    }
+
+    friend constexpr bool operator==(const record_iterator& lhs, const record_iterator& rhs) noexcept {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    // Index of the record.
+    constexpr difference_type position() const noexcept { return pos_; }
+
+  private:
+    static constexpr int sustained = mapped_records<Record>::sustained_steps;
+
+    // Sets [lo_, hi_) to the window holding pos_ and prefetches the next one
+    // in direction dir.
+    void hint(int dir) noexcept {
+        const difference_type w    = mapped_records<Record>::window_records;
+        lo_                        = pos_ >= 0 ? pos_ / w * w : pos_;
+        hi_                        = lo_ + w;
+        const difference_type next = dir > 0 ? hi_ : lo_ - w;
+        if (next >= 0)
+            parent_->advise(next, w, mapped_file::advice::willneed);
+    }
+
+    const mapped_records<Record>* parent_ = nullptr;
+    difference_type               pos_    = 0;
+    difference_type               lo_     = 0;
+    difference_type               hi_     = 0;
+    // Consecutive increments since the last jump, negated for decrements.
+    int steps_ = 0;
+};
+
+// The records of a file of fixed-size Records, as a random access range of
+// references into a mapping of the file; a trailing partial record is
+// ignored.  Like filter_view, the iterators point to the range, so they are
+// invalidated when it is moved or destroyed.
+template <class Record>
+    requires std::is_trivially_copyable_v<Record>
+class mapped_records : public std::ranges::view_interface<mapped_records<Record>> {
+  public:
+    using iterator = record_iterator<Record>;
+
+    // Size in bytes of the windows that iterators prefetch.
+    static constexpr std::size_t window = std::size_t(4) << 20;
+
+    static constexpr std::ptrdiff_t window_records =
+        static_cast<std::ptrdiff_t>(window / sizeof(Record) > 0 ? window / sizeof(Record) : 1);
+
+    // Number of steps in one direction after which iterators read ahead.
+    static constexpr int sustained_steps = 8;
+
+    mapped_records() = default;
+
+    // Maps the file at path.  No access pattern is advised for the whole
+    // file: the iterators may be used sequentially or for random access.
+    explicit mapped_records(const char* path) : mapped_records(mapped_file(path)) {}
+
+    explicit mapped_records(mapped_file file) noexcept : file_(std::move(file)), records_(start_lifetime()) {}
+
+    mapped_records(mapped_records&& other) noexcept
+        : file_(std::move(other.file_)), records_(std::exchange(other.records_, nullptr)) {}
+
+    mapped_records& operator=(mapped_records&& other) noexcept {
+        file_    = std::move(other.file_);
+        records_ = std::exchange(other.records_, nullptr);
+        return *this;
+    }
+
+    iterator begin() const noexcept { return iterator(*this, 0); }
+    iterator end() const noexcept { return iterator(*this, ssize()); }
+
+    std::size_t    size() const noexcept { return file_.size() / sizeof(Record); }
+    std::ptrdiff_t ssize() const noexcept { return static_cast<std::ptrdiff_t>(size()); }
+
+    // The mapped records.
+    const Record* data() const noexcept { return records_; }
+
+    const mapped_file& file() const noexcept { return file_; }
+
+  private:
+    friend iterator;
+
+    // The records of the mapping, created once when it is adopted.  The
+    // mapping is page aligned, so they are as aligned as Record requires.
+    // With std::start_lifetime_as_array (C++23), the Records are created in
+    // the mapping.  Otherwise the bytes are only cast: no Record is formally
+    // created there, and the result relies on Record being trivially
+    // copyable, in practice implicit-lifetime, which compilers let be read in
+    // place.
+    const Record* start_lifetime() const noexcept {
+        if (!file_.data())
+            return nullptr;
+    #if defined(__cpp_lib_start_lifetime_as) && __cpp_lib_start_lifetime_as >= 202207L
+        return std::start_lifetime_as_array<Record>(file_.data(), size());
+    #else
+        return reinterpret_cast<const Record*>(file_.data());
+    #endif
+    }
+
+    void advise(std::ptrdiff_t first, std::ptrdiff_t count, mapped_file::advice a) const noexcept {
+        file_.advise(
+            static_cast<std::size_t>(first) * sizeof(Record), static_cast<std::size_t>(count) * sizeof(Record), a);
+    }
+
+    mapped_file   file_;
+    const Record* records_ = nullptr;
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
+
+#endif
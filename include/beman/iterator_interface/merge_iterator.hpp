@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/merge_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_MERGE_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_MERGE_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+template <std::forward_iterator It, class Compare = std::ranges::less>
+    requires std::indirect_strict_weak_order<Compare, It>
+class merge_view;
+
+// The iterator of merge_view: a forward iterator holding its own cursor into
+// the merge, the position in every run and the tournament tree over them, so
+// that copies advance independently and an iterator kept behind, as
+// std::max_element keeps the largest so far, costs nothing to come back to.
+// Copying one costs O(k), except for the end iterator, which holds no
+// cursor.  Iterators compare by the number of elements consumed, and are
+// only comparable within one view.  Like filter_view's, they point to the
+// view for the ends of the runs and the comparison, so they are invalidated
+// when it is moved or destroyed.
+template <std::forward_iterator It, class Compare = std::ranges::less>
+class merge_iterator : public ext_iterator_interface_compat<merge_iterator<It, Compare>,
+                                                            std::forward_iterator_tag,
+                                                            std::iter_value_t<It>,
+                                                            std::iter_reference_t<It>,
+                                                            std::add_pointer_t<std::iter_reference_t<It>>,
+                                                            std::iter_difference_t<It>> {
+    using base_type = ext_iterator_interface_compat<merge_iterator<It, Compare>,
+                                                    std::forward_iterator_tag,
+                                                    std::iter_value_t<It>,
+                                                    std::iter_reference_t<It>,
+                                                    std::add_pointer_t<std::iter_reference_t<It>>,
+                                                    std::iter_difference_t<It>>;
+
+  public:
+    using typename base_type::difference_type;
+
+    merge_iterator() = default;
+
+    // An iterator at the first element of the merge of parent's runs.
+    constexpr explicit merge_iterator(const merge_view<It, Compare>& parent) : parent_(std::addressof(parent)) {
+        for (const auto& r : parent.runs_)
+            current_.push_back(r.first);
+        build();
+    }
+
+    // An iterator pos elements into parent, holding no cursor, e.g. its end.
+    constexpr merge_iterator(const merge_view<It, Compare>& parent, difference_type pos) noexcept
+        : parent_(std::addressof(parent)), pos_(pos) {}
+
+    constexpr std::iter_reference_t<It> operator*() const { return *current_[tree_[0]]; }
+
+    constexpr merge_iterator& operator++() {
+        const std::size_t w = tree_[0];
+        ++current_[w];
+        ++pos_;
+        replay(w);
+        return *this;
+    }
+
+    using base_type::operator++;
+
+    friend constexpr bool operator==(const merge_iterator& lhs, const merge_iterator& rhs) noexcept {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend constexpr difference_type operator-(const merge_iterator& lhs, const merge_iterator& rhs) noexcept {
+        return lhs.pos_ - rhs.pos_;
+    }
+
+    // Number of elements consumed so far.
+    constexpr difference_type position() const noexcept { return pos_; }
+
+  private:
+    friend iterator_interface_access;
+
+    constexpr const It& last(std::size_t i) const noexcept { return parent_->runs_[i].last; }
+
+    constexpr bool exhausted(std::size_t i) const { return current_[i] == last(i); }
+
+    // Whether the element e of run a wins against the current element v of
+    // run b: !(v < e) when a comes first, e < v otherwise.  Both cases make
+    // one comparison, with the operands selected without a branch.
+    template <class E>
+    constexpr bool ahead(std::size_t a, const E& e, std::size_t b) const {
+        const E&   v     = *current_[b];
+        const bool first = a < b;
+        const E*   lhs   = first ? std::addressof(v) : std::addressof(e);
+        const E*   rhs   = first ? std::addressof(e) : std::addressof(v);
+        return first != static_cast<bool>(std::invoke(parent_->comp_, *lhs, *rhs));
+    }
+
+    // Whether run a wins against run b, exhausted runs losing to all others.
+    constexpr bool beats(std::size_t a, std::size_t b) const {
+        if (exhausted(a))
+            return false;
+        return exhausted(b) || ahead(a, *current_[a], b);
+    }
+
+    // Leaves are the nodes k to 2k - 1 of an implicit tree whose node n has
+    // parent n / 2; tree_[n] is the loser at inner node n and tree_[0] the
+    // overall winner.
+    constexpr void build() {
+        const std::size_t k = current_.size();
+        tree_.assign(k, 0);
+        std::vector<std::size_t> winners(k);
+        const auto               winner = [&](std::size_t node) { return node >= k ? node - k : winners[node]; };
+        for (std::size_t node = k; node-- > 1;) {
+            const std::size_t l = winner(2 * node);
+            const std::size_t r = winner(2 * node + 1);
+            if (beats(r, l)) {
+                winners[node] = r;
+                tree_[node]   = l;
+            } else {
+                winners[node] = l;
+                tree_[node]   = r;
+            }
+        }
+        tree_[0] = k > 1 ? winners[1] : 0;
+    }
+
+    // Restores the tree after the element of run w was consumed.
+    constexpr void replay(std::size_t w) {
+        for (std::size_t node = (w + current_.size()) / 2; node > 0; node /= 2) {
+            if (beats(tree_[node], w))
+                std::swap(tree_[node], w);
+        }
+        tree_[0] = w;
+    }
+
+    // The run that would win if the current winner were exhausted: the best of
+    // the losers on the winner's path, or the winner itself when k = 1.
+    constexpr std::size_t runner_up() const {
+        const std::size_t w    = tree_[0];
+        std::size_t       best = w;
+        for (std::size_t node = (w + current_.size()) / 2; node > 0; node /= 2) {
+            if (best == w || beats(tree_[node], best))
+                best = tree_[node];
+        }
+        return best;
+    }
+
+    // End of the stretch of [first, last) that stays ahead of run c, which
+    // starts at first since run w is the winner.
+    constexpr It stretch_end(std::size_t w, std::size_t c, It first, It last) const {
+        const auto pred = [&](const auto& e) { return ahead(w, e, c); };
+        // Gallop: the stretches are usually short.
+        const difference_type n  = last - first;
+        difference_type       lo = 0;
+        difference_type       hi = 1;
+        while (hi < n && pred(first[hi])) {
+            lo = hi;
+            hi = std::min(2 * hi, n);
+        }
+        return std::partition_point(first + lo, first + std::min(hi, n), pred);
+    }
+
+    // Copies one element at a time while the winner keeps changing, and
+    // drains the winning run up to the runner-up once it wins twice in a row.
+    template <std::weakly_incrementable Out>
+        requires std::indirectly_copyable<It, Out>
+    constexpr Out read_n(Out out, difference_type n) {
+        while (n > 0) {
+            const std::size_t w = tree_[0];
+            It&               r = current_[w];
+            *out                = *r;
+            ++r;
+            ++out;
+            ++pos_;
+            --n;
+            replay(w);
+            if (n == 0 || tree_[0] != w)
+                continue;
+
+            const std::size_t c     = runner_up();
+            const bool        alone = c == w || exhausted(c);
+            difference_type   done  = 0;
+            if constexpr (std::random_access_iterator<It>) {
+                const It limit = r + std::min(n, last(w) - r);
+                const It stop  = alone ? limit : stretch_end(w, c, r, limit);
+                done           = stop - r;
+                out            = std::ranges::copy(r, stop, std::move(out)).out;
+                r              = stop;
+            } else {
+                for (; done != n && r != last(w) && (alone || ahead(w, *r, c)); ++done) {
+                    *out = *r;
+                    ++r;
+                    ++out;
+                }
+            }
+            pos_ += done;
+            n -= done;
+            replay(w);
+        }
+        return out;
+    }
+
+    const merge_view<It, Compare>* parent_ = nullptr;
+    std::vector<It>                current_;
+    std::vector<std::size_t>       tree_;
+    difference_type                pos_ = 0;
+};
+
+// The k-way merge of sorted runs [first_i, last_i), e.g. sorted spill files or
+// log segments, as a forward range.  The merge is stable: equivalent elements
+// come out in the order of their runs.
+//
+// The runs are the leaves of a tournament tree whose inner nodes hold the
+// loser of the match played there, so that an increment replays only the path
+// from the winner's leaf to the root: ceil(log2 k) comparisons, against the up
+// to 2 log2 k of a binary heap and without moving any element.  Copying out
+// with the algorithm.hpp functions goes through read_n, which finds the
+// runner-up once and then copies the winning run for as long as it stays
+// ahead of it: one comparison per element, or a galloping search and a
+// single std::copy when It is random access.
+//
+// The view holds the runs and the comparison, and is not modified by
+// iterating it: the cursors are in the iterators.  It is move-only, as
+// copying it would copy the runs.
+template <std::forward_iterator It, class Compare>
+    requires std::indirect_strict_weak_order<Compare, It>
+class merge_view : public std::ranges::view_interface<merge_view<It, Compare>> {
+    struct run {
+        It first;
+        It last;
+    };
+
+  public:
+    using iterator        = merge_iterator<It, Compare>;
+    using difference_type = std::iter_difference_t<It>;
+
+    merge_view() = default;
+
+    // Merges the ranges of runs, each of which must be sorted with respect to
+    // comp.
+    template <std::ranges::input_range Runs>
+        requires std::ranges::forward_range<std::ranges::range_reference_t<Runs>> &&
+                 std::same_as<std::ranges::iterator_t<std::ranges::range_reference_t<Runs>>, It> &&
+                 std::same_as<std::ranges::sentinel_t<std::ranges::range_reference_t<Runs>>, It>
+    constexpr explicit merge_view(Runs&& runs, Compare comp = Compare()) : comp_(std::move(comp)) {
+        for (auto&& r : runs) {
+            runs_.push_back(run{std::ranges::begin(r), std::ranges::end(r)});
+            size_ += std::ranges::distance(r);
+        }
+        // An empty run, so that the winner of no runs is one.
+        if (runs_.empty())
+            runs_.push_back(run{});
+    }
+
+    merge_view(merge_view&&)            = default;
+    merge_view& operator=(merge_view&&) = default;
+
+    constexpr iterator begin() const { return iterator(*this); }
+    constexpr iterator end() const noexcept { return iterator(*this, size_); }
+
+    constexpr std::size_t size() const noexcept { return static_cast<std::size_t>(size_); }
+
+  private:
+    friend iterator;
+
+    std::vector<run>              runs_;
+    difference_type               size_ = 0;
+    [[no_unique_address]] Compare comp_{};
+};
+
+// The merge of the sorted runs, as a merge_view.
+template <std::ranges::input_range Runs, class Compare = std::ranges::less>
+    requires std::ranges::forward_range<std::ranges::range_reference_t<Runs>> &&
+             std::ranges::common_range<std::ranges::range_reference_t<Runs>>
+constexpr auto merge_runs(Runs&& runs, Compare comp = Compare()) {
+    using It = std::ranges::iterator_t<std::ranges::range_reference_t<Runs>>;
+    return merge_view<It, Compare>(std::forward<Runs>(runs), std::move(comp));
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
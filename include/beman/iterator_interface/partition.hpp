@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/partition.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_PARTITION_HPP
+#define BEMAN_ITERATOR_INTERFACE_PARTITION_HPP
+
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace detail {
+template <class It, class Out>
+concept splittable = requires(const It& first, const It& last, std::iter_difference_t<It> n, Out out) {
+    { iterator_interface_access::split(first, last, n, std::move(out)) } -> std::same_as<Out>;
+};
+
+// Length of part i when size elements are cut into n parts: the first
+// size % n parts get one element more than the others.
+template <class Diff>
+constexpr Diff part_size(Diff size, Diff n, Diff i) noexcept {
+    return size / n + (i < size % n ? 1 : 0);
+}
+} // namespace detail
+
+// The algorithms live in namespace algorithms, which argument-dependent
+// lookup does not search for the iterators of this library, so that they are
+// only found when asked for, e.g. as algorithms::partition_range.
+namespace algorithms {
+// Cuts [first, last) into n consecutive sub-ranges, e.g. one per thread.
+// Requires n > 0; some of the parts are empty when there are fewer than n
+// elements.
+//
+// Random access iterators are cut with operator- and operator+= into parts
+// whose lengths differ by at most one.  Other iterators that provide the split
+// hook (see iterator_interface_access) are cut where it says, which is how
+// filter_iterator over a random access range is cut without evaluating its
+// predicate on the whole range.  The remaining ones are walked twice, once to
+// count the elements and once to cut them.
+template <std::forward_iterator It>
+constexpr std::vector<std::ranges::subrange<It>> partition_range(It first, It last, std::iter_difference_t<It> n) {
+    using diff_type = std::iter_difference_t<It>;
+
+    std::vector<It> bounds;
+    bounds.reserve(static_cast<std::size_t>(n) + 1);
+    bounds.push_back(first);
+    if constexpr (std::random_access_iterator<It>) {
+        const diff_type size = last - first;
+        for (diff_type i = 0; i + 1 < n; ++i) {
+            first += detail::part_size(size, n, i);
+            bounds.push_back(first);
+        }
+    } else if constexpr (detail::splittable<It, std::back_insert_iterator<std::vector<It>>>) {
+        iterator_interface_access::split(first, last, n, std::back_inserter(bounds));
+    } else {
+        const diff_type size = std::ranges::distance(first, last);
+        for (diff_type i = 0; i + 1 < n; ++i) {
+            std::ranges::advance(first, detail::part_size(size, n, i));
+            bounds.push_back(first);
+        }
+    }
+    bounds.push_back(std::move(last));
+
+    std::vector<std::ranges::subrange<It>> parts;
+    parts.reserve(static_cast<std::size_t>(n));
+    for (std::size_t i = 0; i + 1 < bounds.size(); ++i)
+        parts.emplace_back(std::move(bounds[i]), bounds[i + 1]);
+    return parts;
+}
+} // namespace algorithms
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
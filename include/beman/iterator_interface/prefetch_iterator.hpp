@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/prefetch_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_PREFETCH_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_PREFETCH_ITERATOR_HPP
+
+#include <beman/iterator_interface/detail/prefetch.hpp>
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace detail {
+template <class It>
+using prefetch_concept_t = std::
+    conditional_t<std::random_access_iterator<It>, std::random_access_iterator_tag, std::forward_iterator_tag>;
+
+struct no_lookahead {};
+} // namespace detail
+
+// Adapts an iterator over elements that are expensive to reach, e.g. through
+// a shuffled index or a vector of pointers, so that every increment also
+// prefetches the element Distance positions ahead.  The prefetch stops
+// Distance elements before the end of the range, which the iterator keeps.
+//
+// With a random access base the element ahead is addressed with operator[]
+// (it[Distance]), which costs no traversal.  Other bases are forward
+// iterators here and keep a second base iterator Distance positions ahead,
+// so they only gain when advancing is cheaper than dereferencing.
+template <std::forward_iterator It, std::iter_difference_t<It> Distance = 16>
+    requires std::is_lvalue_reference_v<std::iter_reference_t<It>> && (Distance > 0)
+class prefetch_iterator : public ext_iterator_interface_compat<prefetch_iterator<It, Distance>,
+                                                               detail::prefetch_concept_t<It>,
+                                                               std::iter_value_t<It>,
+                                                               std::iter_reference_t<It>,
+                                                               std::add_pointer_t<std::iter_reference_t<It>>,
+                                                               std::iter_difference_t<It>> {
+    using base_type = ext_iterator_interface_compat<prefetch_iterator<It, Distance>,
+                                                    detail::prefetch_concept_t<It>,
+                                                    std::iter_value_t<It>,
+                                                    std::iter_reference_t<It>,
+                                                    std::add_pointer_t<std::iter_reference_t<It>>,
+                                                    std::iter_difference_t<It>>;
+
+    static constexpr bool random_access = std::random_access_iterator<It>;
+
+  public:
+    using typename base_type::difference_type;
+
+    prefetch_iterator() = default;
+    constexpr prefetch_iterator(It current, It last) : current_(std::move(current)), last_(std::move(last)) {
+        if constexpr (random_access) {
+            fetch_ahead();
+        } else {
+            ahead_ = std::ranges::next(current_, Distance, last_);
+            if (ahead_ != last_)
+                detail::prefetch(std::addressof(*ahead_));
+        }
+    }
+
+    constexpr const It& base() const& noexcept { return current_; }
+    constexpr It        base() && { return std::move(current_); }
+
+    constexpr std::iter_reference_t<It> operator*() const { return *current_; }
+
+    constexpr prefetch_iterator& operator++() {
+        ++current_;
+        if constexpr (random_access) {
+            fetch_ahead();
+        } else if (ahead_ != last_) {
+            if (++ahead_ != last_)
+                detail::prefetch(std::addressof(*ahead_));
+        }
+        return *this;
+    }
+
+    using base_type::operator++;
+
+    friend constexpr bool operator==(const prefetch_iterator& lhs, const prefetch_iterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+  private:
+    friend iterator_interface_access;
+
+    // Arithmetic and comparisons other than == for random access bases; the
+    // next increment prefetches again after a jump.
+    constexpr It& base_reference() noexcept
+        requires random_access
+    {
+        return current_;
+    }
+    constexpr const It& base_reference() const noexcept
+        requires random_access
+    {
+        return current_;
+    }
+
+    constexpr void fetch_ahead() {
+        if (last_ - current_ > Distance)
+            detail::prefetch(std::addressof(current_[Distance]));
+    }
+
+    It                                                                                  current_{};
+    It                                                                                  last_{};
+    [[no_unique_address]] std::conditional_t<random_access, detail::no_lookahead, It> ahead_{};
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/segmented_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_SEGMENTED_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_SEGMENTED_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <concepts>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+// A segmented iterator (e.g. the iterator of a deque-like or chunked container)
+// opts in by providing, accessible to iterator_interface_access:
+//
+//   segment_iterator      segment() const;
+//   local_iterator        local() const;
+//   static local_iterator segment_begin(const segment_iterator&);
+//   static local_iterator segment_end(const segment_iterator&);
+//   static D              compose(const segment_iterator&, const local_iterator&);
+//
+// local_iterator must be contiguous, and local() must lie within
+// [segment_begin(segment()), segment_end(segment())] for every valid iterator,
+// including past-the-end ones.
+
+namespace detail {
+template <class It>
+using segment_iterator_t =
+    std::remove_cvref_t<decltype(iterator_interface_access::segment(std::declval<const It&>()))>;
+
+template <class It>
+using local_iterator_t = std::remove_cvref_t<decltype(iterator_interface_access::local(std::declval<const It&>()))>;
+} // namespace detail
+
+template <class It>
+concept segmented_iterator =
+    requires {
+        typename detail::segment_iterator_t<It>;
+        typename detail::local_iterator_t<It>;
+    } && std::forward_iterator<detail::segment_iterator_t<It>> &&
+    std::contiguous_iterator<detail::local_iterator_t<It>> &&
+    requires(const detail::segment_iterator_t<It>& s, const detail::local_iterator_t<It>& l) {
+        {
+            iterator_interface_access::segment_begin<It>(s)
+        } -> std::same_as<detail::local_iterator_t<It>>;
+        {
+            iterator_interface_access::segment_end<It>(s)
+        } -> std::same_as<detail::local_iterator_t<It>>;
+        {
+            iterator_interface_access::compose<It>(s, l)
+        } -> std::same_as<It>;
+    };
+
+template <class It>
+struct segmented_iterator_traits;
+
+template <segmented_iterator It>
+struct segmented_iterator_traits<It> {
+    using segment_iterator = detail::segment_iterator_t<It>;
+    using local_iterator   = detail::local_iterator_t<It>;
+
+    static constexpr segment_iterator segment(const It& it) { return iterator_interface_access::segment(it); }
+    static constexpr local_iterator   local(const It& it) { return iterator_interface_access::local(it); }
+    static constexpr local_iterator   begin(const segment_iterator& s) {
+        return iterator_interface_access::segment_begin<It>(s);
+    }
+    static constexpr local_iterator end(const segment_iterator& s) {
+        return iterator_interface_access::segment_end<It>(s);
+    }
+    static constexpr It compose(const segment_iterator& s, const local_iterator& l) {
+        return iterator_interface_access::compose<It>(s, l);
+    }
+};
+
+namespace detail {
+// Calls f(segment, local_first, local_last) for each non-overlapping
+// contiguous piece of [first, last), in order, until f returns true.
+template <segmented_iterator It, class F>
+constexpr void visit_segments(const It& first, const It& last, F&& f) {
+    using traits = segmented_iterator_traits<It>;
+
+    auto       sfirst = traits::segment(first);
+    const auto slast  = traits::segment(last);
+    if (sfirst == slast) {
+        f(sfirst, traits::local(first), traits::local(last));
+        return;
+    }
+    if (f(sfirst, traits::local(first), traits::end(sfirst)))
+        return;
+    for (++sfirst; sfirst != slast; ++sfirst) {
+        if (f(sfirst, traits::begin(sfirst), traits::end(sfirst)))
+            return;
+    }
+    f(slast, traits::begin(slast), traits::local(last));
+}
+} // namespace detail
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/set_bit_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_SET_BIT_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_SET_BIT_ITERATOR_HPP
+
+#include <beman/iterator_interface/bit_iterator.hpp>
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+// A forward iterator over the indices of the set bits of a bitmap of size bits
+// packed into Words as for bit_iterator, in increasing order; or, when Maps >
+// 1, of the bits set in all of Maps bitmaps of the same size, which are ANDed a
+// word at a time as the iterator goes, without materializing the
+// intersection.  Bits of the last word past size are ignored.
+//
+// The iterator holds the remaining bits of its word: incrementing it clears
+// the lowest of them, and dereferencing takes its std::countr_zero.  When the
+// word runs out, the following words are tested in groups of skip_words,
+// which compilers turn into vector loads and a single test, so that sparse
+// bitmaps are skipped at memory speed.  The remaining bits are zero only at
+// the end, so that comparing with std::default_sentinel tests one register.
+template <detail::bit_word Word = std::uint64_t, std::size_t Maps = 1>
+    requires(Maps > 0)
+class set_bit_iterator : public ext_proxy_iterator_interface_compat<set_bit_iterator<Word, Maps>,
+                                                                    std::forward_iterator_tag,
+                                                                    std::ptrdiff_t,
+                                                                    std::ptrdiff_t,
+                                                                    std::ptrdiff_t> {
+    using base_type = ext_proxy_iterator_interface_compat<set_bit_iterator<Word, Maps>,
+                                                          std::forward_iterator_tag,
+                                                          std::ptrdiff_t,
+                                                          std::ptrdiff_t,
+                                                          std::ptrdiff_t>;
+    using word_type = std::remove_const_t<Word>;
+
+    static constexpr std::ptrdiff_t bits = detail::word_bits<Word>;
+
+  public:
+    using typename base_type::difference_type;
+
+    // Number of words tested at once when skipping zero words.
+    static constexpr std::ptrdiff_t skip_words = 8;
+
+    set_bit_iterator() = default;
+
+    // The first set bit of the bitmaps maps, of size bits each.
+    constexpr set_bit_iterator(const std::array<const word_type*, Maps>& maps, difference_type size) noexcept
+        : maps_(maps), words_((size + bits - 1) / bits),
+          tail_(detail::low_bits<word_type>(size % bits == 0 ? bits : size % bits)), index_(-1) {
+        next_word();
+    }
+
+    constexpr difference_type operator*() const noexcept { return index_ * bits + std::countr_zero(current_); }
+
+    constexpr set_bit_iterator& operator++() noexcept {
+        current_ &= static_cast<word_type>(current_ - 1);
+        if (current_ == 0)
+            next_word();
+        return *this;
+    }
+
+    using base_type::operator++;
+
+    friend constexpr bool operator==(const set_bit_iterator& lhs, const set_bit_iterator& rhs) noexcept {
+        return lhs.index_ == rhs.index_ && lhs.current_ == rhs.current_;
+    }
+
+    friend constexpr bool operator==(const set_bit_iterator& it, std::default_sentinel_t) noexcept {
+        return it.current_ == 0;
+    }
+
+  private:
+    // Word i of the intersection of the bitmaps, before masking the tail.
+    constexpr word_type load(difference_type i) const noexcept {
+        word_type w = maps_[0][i];
+        for (std::size_t m = 1; m != Maps; ++m)
+            w &= maps_[m][i];
+        return w;
+    }
+
+    // Moves to the next word with a set bit, or to the end.
+    constexpr void next_word() noexcept {
+        ++index_;
+        for (; index_ + skip_words < words_; index_ += skip_words) {
+            word_type any = 0;
+            for (difference_type k = 0; k != skip_words; ++k)
+                any |= load(index_ + k);
+            if (any != 0)
+                break;
+        }
+        for (; index_ < words_; ++index_) {
+            current_ = load(index_);
+            if (index_ == words_ - 1)
+                current_ &= tail_;
+            if (current_ != 0)
+                return;
+        }
+        current_ = 0;
+    }
+
+    std::array<const word_type*, Maps> maps_{};
+    difference_type                    words_   = 0;
+    word_type                          tail_    = 0;
+    difference_type                    index_   = 0;
+    word_type                          current_ = 0;
+};
+
+// The indices of the set bits of the first size bits of words, as a range.
+template <detail::bit_word Word>
+constexpr std::ranges::subrange<set_bit_iterator<std::remove_const_t<Word>>, std::default_sentinel_t>
+set_bit_indices(Word* words, std::ptrdiff_t size) noexcept {
+    return {set_bit_iterator<std::remove_const_t<Word>>({words}, size), std::default_sentinel};
+}
+
+// The indices of the bits set in both a and b, of size bits each, as a range.
+template <detail::bit_word Word>
+constexpr std::ranges::subrange<set_bit_iterator<std::remove_const_t<Word>, 2>, std::default_sentinel_t>
+set_bit_indices(Word* a, Word* b, std::ptrdiff_t size) noexcept {
+    return {set_bit_iterator<std::remove_const_t<Word>, 2>({a, b}, size), std::default_sentinel};
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/strided_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_STRIDED_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_STRIDED_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace beman {
+namespace iterator_interface {
+
+// The Stride of a strided_iterator whose stride is given at run time.
+inline constexpr std::ptrdiff_t dynamic_stride = 0;
+
+namespace detail {
+template <std::ptrdiff_t Stride>
+struct stride_holder {
+    static constexpr std::ptrdiff_t value() noexcept { return Stride; }
+};
+
+template <>
+struct stride_holder<dynamic_stride> {
+    constexpr std::ptrdiff_t value() const noexcept { return stride; }
+
+    std::ptrdiff_t stride = 1;
+};
+} // namespace detail
+
+// A random access iterator over first[0], first[stride], first[2 * stride],
+// ..., e.g. a column of a row-major matrix or one channel of interleaved
+// audio frames.  The stride is Stride, or given at construction when Stride is
+// dynamic_stride; it may be negative.
+//
+// The iterator holds first and an index, so that the end of a range may lie
+// more than one element past the array without forming an out of bounds
+// pointer, and distances are index differences.  Copying out of it or into it
+// with the algorithm.hpp functions goes through read_n and write_n, and
+// transforming out of it through the transform hook, plain indexed loops over
+// a pointer.  With a small compile-time Stride, these and the standard
+// algorithms over the iterator itself vectorize into loads and shuffles (or
+// gathers, where the target has them); with a run-time stride, the vectors
+// are at best filled one element at a time.
+template <class T, std::ptrdiff_t Stride = dynamic_stride>
+class strided_iterator
+    : public ext_iterator_interface_compat<strided_iterator<T, Stride>, std::random_access_iterator_tag, T> {
+    using base_type = ext_iterator_interface_compat<strided_iterator<T, Stride>, std::random_access_iterator_tag, T>;
+
+  public:
+    using typename base_type::difference_type;
+
+    strided_iterator() = default;
+
+    constexpr explicit strided_iterator(T* first, difference_type index = 0) noexcept
+        requires(Stride != dynamic_stride)
+        : first_(first), index_(index) {}
+
+    // Requires stride != 0.
+    constexpr strided_iterator(T* first, difference_type stride, difference_type index) noexcept
+        requires(Stride == dynamic_stride)
+        : first_(first), index_(index), stride_{stride} {}
+
+    constexpr T& operator*() const noexcept { return first_[index_ * stride()]; }
+
+    constexpr strided_iterator& operator+=(difference_type n) noexcept {
+        index_ += n;
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const strided_iterator& lhs, const strided_iterator& rhs) noexcept {
+        return lhs.index_ - rhs.index_;
+    }
+
+    friend constexpr bool operator==(const strided_iterator& lhs, const strided_iterator& rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+
+    // The pointer the iterator was made from, and the position of the iterator
+    // from it in strides: the iterator refers to base()[index() * stride()].
+    // Both are valid for every iterator, including the end of a range.
+    constexpr T* base() const noexcept { return first_; }
+
+    constexpr difference_type index() const noexcept { return index_; }
+
+    constexpr difference_type stride() const noexcept { return stride_.value(); }
+
+  private:
+    friend iterator_interface_access;
+
+    template <class U>
+        requires std::same_as<std::remove_const_t<T>, U>
+    constexpr U* read_n(U* out, difference_type n) noexcept {
+        if (n <= 0)
+            return out;
+        const difference_type s = stride();
+        const T* const        p = first_ + index_ * s;
+        if constexpr (Stride == 1) {
+            out = std::copy(p, p + n, out);
+        } else {
+            for (difference_type i = 0; i != n; ++i)
+                out[i] = p[i * s];
+            out += n;
+        }
+        index_ += n;
+        return out;
+    }
+
+    template <std::input_iterator In>
+        requires std::indirectly_writable<T*, std::iter_reference_t<In>>
+    constexpr In write_n(In in, difference_type n) {
+        if (n <= 0)
+            return in;
+        const difference_type s = stride();
+        T* const              p = first_ + index_ * s;
+        if constexpr (std::random_access_iterator<In>) {
+            for (difference_type i = 0; i != n; ++i)
+                p[i * s] = in[i];
+            in += n;
+        } else {
+            for (difference_type i = 0; i != n; ++i, ++in)
+                p[i * s] = *in;
+        }
+        index_ += n;
+        return in;
+    }
+
+    // The transform hook: op applied to each element of [*this, last), in the
+    // same indexed loop as read_n.
+    template <class U, class F>
+        requires std::indirectly_writable<U*, std::invoke_result_t<F&, T&>>
+    constexpr U* transform(const strided_iterator& last, U* out, F& op) const {
+        const difference_type n = last.index_ - index_;
+        if (n <= 0)
+            return out;
+        const difference_type s = stride();
+        T* const              p = first_ + index_ * s;
+        for (difference_type i = 0; i != n; ++i)
+            out[i] = op(p[i * s]);
+        return out + n;
+    }
+
+    T*                                                  first_ = nullptr;
+    difference_type                                     index_ = 0;
+    [[no_unique_address]] detail::stride_holder<Stride> stride_{};
+};
+
+// The count elements first[0], first[Stride], ..., as a range.
+template <std::ptrdiff_t Stride, class T>
+    requires(Stride != dynamic_stride)
+constexpr std::ranges::subrange<strided_iterator<T, Stride>> strided(T* first, std::ptrdiff_t count) noexcept {
+    return {strided_iterator<T, Stride>(first), strided_iterator<T, Stride>(first, count)};
+}
+
+// The count elements first[0], first[stride], ..., as a range.
+template <class T>
+constexpr std::ranges::subrange<strided_iterator<T>>
+strided(T* first, std::ptrdiff_t stride, std::ptrdiff_t count) noexcept {
+    return {strided_iterator<T>(first, stride, 0), strided_iterator<T>(first, stride, count)};
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/transform_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_TRANSFORM_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_TRANSFORM_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+template <std::forward_iterator It, class F, std::size_t Cache = 0>
+    requires std::is_object_v<F> && std::regular_invocable<const F&, std::iter_reference_t<It>>
+class transform_view;
+
+template <class It, class F, std::size_t Cache = 0>
+class transform_iterator;
+
+namespace detail {
+template <class It, class F>
+using transform_result_t = std::invoke_result_t<const F&, std::iter_reference_t<It>>;
+
+template <class It>
+using transform_concept_t =
+    std::conditional_t<std::random_access_iterator<It>,
+                       std::random_access_iterator_tag,
+                       std::conditional_t<std::bidirectional_iterator<It>,
+                                          std::bidirectional_iterator_tag,
+                                          std::forward_iterator_tag>>;
+
+// The reference type: the result of f, or a copy of the cached value.
+template <class It, class F, std::size_t Cache>
+using transform_reference_t =
+    std::conditional_t<(Cache > 0), std::remove_cvref_t<transform_result_t<It, F>>, transform_result_t<It, F>>;
+
+template <class Derived,
+          class It,
+          class F,
+          std::size_t Cache,
+          bool = std::is_reference_v<transform_reference_t<It, F, Cache>>>
+struct transform_base {
+    using type = ext_iterator_interface_compat<Derived,
+                                               transform_concept_t<It>,
+                                               std::remove_cvref_t<transform_result_t<It, F>>,
+                                               transform_reference_t<It, F, Cache>,
+                                               std::add_pointer_t<transform_reference_t<It, F, Cache>>,
+                                               std::iter_difference_t<It>>;
+};
+
+template <class Derived, class It, class F, std::size_t Cache>
+struct transform_base<Derived, It, F, Cache, false> {
+    using type = ext_proxy_iterator_interface_compat<Derived,
+                                                     transform_concept_t<It>,
+                                                     std::remove_cvref_t<transform_result_t<It, F>>,
+                                                     transform_reference_t<It, F, Cache>,
+                                                     std::iter_difference_t<It>>;
+};
+
+template <class Derived, class It, class F, std::size_t Cache>
+using transform_base_t = typename transform_base<Derived, It, F, Cache>::type;
+
+// The values of f at the last Size positions dereferenced, replaced in least
+// recently used order.
+template <class It, class V, std::size_t Size>
+struct transform_cache {
+    struct entry {
+        It               position{};
+        std::optional<V> value;
+        std::size_t      used = 0;
+    };
+
+    template <class Compute>
+    constexpr const V& lookup(const It& it, Compute compute) {
+        entry* victim = &entries[0];
+        for (entry& e : entries) {
+            if (e.value && e.position == it) {
+                e.used = ++clock;
+                return *e.value;
+            }
+            if (e.used < victim->used)
+                victim = &e;
+        }
+        victim->value.reset();
+        victim->position = it;
+        victim->used     = ++clock;
+        return victim->value.emplace(compute());
+    }
+
+    std::array<entry, Size> entries{};
+    std::size_t             clock = 0;
+};
+
+template <class It, class V>
+struct transform_cache<It, V, 0> {};
+} // namespace detail
+
+// The iterator of transform_view: dereferencing it applies the view's
+// function to the underlying element, or looks it up in the view's cache.  It
+// holds a pointer to the view and its position, whether or not the view
+// caches.
+template <class It, class F, std::size_t Cache>
+class transform_iterator : public detail::transform_base_t<transform_iterator<It, F, Cache>, It, F, Cache> {
+    using base_type = detail::transform_base_t<transform_iterator<It, F, Cache>, It, F, Cache>;
+
+  public:
+    using typename base_type::difference_type;
+    using typename base_type::reference;
+    using typename base_type::value_type;
+
+    transform_iterator() = default;
+    constexpr transform_iterator(const transform_view<It, F, Cache>& parent, It current)
+        : parent_(std::addressof(parent)), current_(std::move(current)) {}
+
+    constexpr const It& base() const& noexcept { return current_; }
+    constexpr It        base() && { return std::move(current_); }
+
+    constexpr reference operator*() const { return parent_->apply(current_); }
+
+    constexpr transform_iterator& operator++() {
+        ++current_;
+        return *this;
+    }
+
+    constexpr transform_iterator& operator--()
+        requires std::bidirectional_iterator<It>
+    {
+        --current_;
+        return *this;
+    }
+
+    using base_type::operator++;
+    using base_type::operator--;
+
+    constexpr transform_iterator& operator+=(difference_type n)
+        requires std::random_access_iterator<It>
+    {
+        current_ += n;
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const transform_iterator& lhs, const transform_iterator& rhs)
+        requires std::sized_sentinel_for<It, It>
+    {
+        return lhs.current_ - rhs.current_;
+    }
+
+    friend constexpr bool operator==(const transform_iterator& lhs, const transform_iterator& rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+  private:
+    const transform_view<It, F, Cache>* parent_ = nullptr;
+    It                                  current_{};
+};
+
+// The results of f applied to the elements of [first, last), computed when
+// dereferenced.  Like filter_view, the iterators point to the view, so they
+// are invalidated when it is moved or destroyed.
+//
+// With a nonzero Cache, the view memoizes the values of f at the last Cache
+// positions dereferenced, through any of its iterators: algorithms comparing
+// neighbouring elements (std::adjacent_find, std::is_sorted, std::unique) then
+// apply f once per position rather than twice, although they dereference
+// copies of their iterators.  Two entries suffice when the algorithm visits the
+// positions in order, three when it reads *next before *first, as libstdc++'s
+// std::is_sorted does.  Dereferencing returns a copy of the cached value, not
+// a reference into the cache that a later miss could overwrite, so caching
+// pays for functions that cost much more than copying their result.  Lookups
+// update the cache: the iterators of one caching view must not be
+// dereferenced concurrently from several threads.  The cache is keyed by
+// position alone, so the elements of [first, last) must not be modified
+// while the view is in use, or dereferencing may return the value of f for
+// an element's old value; build a new view after such a write.
+template <std::forward_iterator It, class F, std::size_t Cache>
+    requires std::is_object_v<F> && std::regular_invocable<const F&, std::iter_reference_t<It>>
+class transform_view : public std::ranges::view_interface<transform_view<It, F, Cache>> {
+  public:
+    using iterator = transform_iterator<It, F, Cache>;
+
+    transform_view() = default;
+    constexpr transform_view(It first, It last, F f)
+        : first_(std::move(first)), last_(std::move(last)), f_(std::move(f)) {}
+
+    constexpr iterator begin() const { return iterator(*this, first_); }
+    constexpr iterator end() const { return iterator(*this, last_); }
+
+    constexpr const F& function() const noexcept { return f_; }
+
+  private:
+    friend iterator;
+
+    using cache = detail::transform_cache<It, std::remove_cvref_t<detail::transform_result_t<It, F>>, Cache>;
+
+    constexpr detail::transform_reference_t<It, F, Cache> apply(const It& it) const {
+        if constexpr (Cache > 0)
+            return cache_.lookup(it, [&] { return std::invoke(f_, *it); });
+        else
+            return std::invoke(f_, *it);
+    }
+
+    It                                  first_{};
+    It                                  last_{};
+    [[no_unique_address]] F             f_{};
+    [[no_unique_address]] mutable cache cache_{};
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// include/beman/iterator_interface/zip_iterator.hpp -*-C++-*-
+
+#ifndef BEMAN_ITERATOR_INTERFACE_ZIP_ITERATOR_HPP
+#define BEMAN_ITERATOR_INTERFACE_ZIP_ITERATOR_HPP
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/iterator_interface_access.hpp>
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace beman {
+namespace iterator_interface {
+
+template <class... Refs>
+class zip_reference;
+
+namespace detail {
+template <class T>
+inline constexpr bool is_zip_reference = false;
+
+template <class... Refs>
+inline constexpr bool is_zip_reference<zip_reference<Refs...>> = true;
+
+template <class T>
+inline constexpr bool is_tuple = false;
+
+template <class... Ts>
+inline constexpr bool is_tuple<std::tuple<Ts...>> = true;
+
+// A zip_reference or std::tuple of N elements.
+template <class T, std::size_t N>
+concept zip_like = (is_zip_reference<std::remove_cvref_t<T>> || is_tuple<std::remove_cvref_t<T>>) &&
+                   std::tuple_size_v<std::remove_cvref_t<T>> == N;
+
+// Element I of a zip_like, as the reference type of the zip_reference or as
+// std::get returns it.
+template <std::size_t I, class T>
+constexpr decltype(auto) zip_get(T&& t) noexcept {
+    if constexpr (is_zip_reference<std::remove_cvref_t<T>>)
+        return t.template get<I>();
+    else
+        return std::get<I>(std::forward<T>(t));
+}
+
+// The type of zip_get<I>(std::declval<T>()), known before a zip_reference T
+// is complete.
+template <std::size_t I, class T, bool = is_zip_reference<std::remove_cvref_t<T>>>
+struct zip_element {
+    using type = decltype(std::get<I>(std::declval<T>()));
+};
+
+template <std::size_t I, class T>
+struct zip_element<I, T, true> {
+    using type = std::tuple_element_t<I, std::remove_cvref_t<T>>;
+};
+
+template <class T, class... Refs>
+constexpr bool zip_convertible() {
+    return []<std::size_t... I>(std::index_sequence<I...>) {
+        return (std::is_convertible_v<typename zip_element<I, T>::type, Refs> && ...);
+    }(std::index_sequence_for<Refs...>());
+}
+
+template <class T, class... Refs>
+constexpr bool zip_assignable() {
+    return []<std::size_t... I>(std::index_sequence<I...>) {
+        return (std::is_assignable_v<Refs&, typename zip_element<I, T>::type> && ...);
+    }(std::index_sequence_for<Refs...>());
+}
+
+// A tuple of const references to the elements of a zip_like, for comparisons.
+template <class T>
+constexpr auto zip_tie(const T& t) noexcept {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return std::tuple<const std::remove_reference_t<decltype(detail::zip_get<I>(t))>&...>(
+            detail::zip_get<I>(t)...);
+    }(std::make_index_sequence<std::tuple_size_v<T>>());
+}
+
+template <class T, class U>
+concept zip_equality_comparable = requires(const T& t, const U& u) { detail::zip_tie(t) == detail::zip_tie(u); };
+
+template <class T, class U>
+concept zip_three_way_comparable = requires(const T& t, const U& u) { detail::zip_tie(t) <=> detail::zip_tie(u); };
+
+template <class... Its>
+using zip_concept_t =
+    std::conditional_t<(std::random_access_iterator<Its> && ...),
+                       std::random_access_iterator_tag,
+                       std::conditional_t<(std::bidirectional_iterator<Its> && ...),
+                                          std::bidirectional_iterator_tag,
+                                          std::forward_iterator_tag>>;
+} // namespace detail
+
+// The reference type of zip_iterator: a tuple of references Refs..., each of
+// which is an lvalue or rvalue reference, into the same row of several
+// columns.  Unlike std::tuple before C++23 it is a proxy for the row: copies
+// refer to the same elements, assignment assigns the elements, even through a
+// const zip_reference, and std::common_reference with the row's value type
+// std::tuple<T...> is defined, so that zip_iterator satisfies
+// std::indirectly_readable and std::permutable.  It supports structured
+// bindings and get<I>(), and compares lexicographically with zip_references
+// and std::tuples of the same size.
+template <class... Refs>
+class zip_reference {
+    static_assert((std::is_reference_v<Refs> && ...), "the elements of a zip_reference are references");
+
+  public:
+    constexpr explicit zip_reference(Refs... refs) noexcept : refs_(std::forward<Refs>(refs)...) {}
+
+    // From another zip_reference or a std::tuple whose elements bind to Refs,
+    // e.g. zip_reference<T&&...> to zip_reference<const T&...>, or
+    // std::tuple<T...>& to zip_reference<T&...>.
+    template <class T>
+        requires(!std::same_as<std::remove_cvref_t<T>, zip_reference>) && detail::zip_like<T, sizeof...(Refs)> &&
+                (detail::zip_convertible<T, Refs...>())
+    constexpr zip_reference(T&& t) noexcept
+        : zip_reference(std::forward<T>(t), std::index_sequence_for<Refs...>()) {}
+
+    zip_reference(const zip_reference&) = default;
+    zip_reference(zip_reference&&)      = default;
+
+    // Assigns the elements, not the references.
+    constexpr const zip_reference& operator=(const zip_reference& other) const
+        requires(std::is_copy_assignable_v<std::remove_reference_t<Refs>> && ...)
+    {
+        assign(other);
+        return *this;
+    }
+
+    template <class T>
+        requires(!std::same_as<std::remove_cvref_t<T>, zip_reference>) && detail::zip_like<T, sizeof...(Refs)> &&
+                (detail::zip_assignable<T, Refs...>())
+    constexpr const zip_reference& operator=(T&& t) const {
+        assign(std::forward<T>(t));
+        return *this;
+    }
+
+    // The row as a value, e.g. std::tuple<T...>.
+    template <class... Ts>
+        requires(sizeof...(Ts) == sizeof...(Refs)) && (std::constructible_from<Ts, Refs> && ...)
+    constexpr operator std::tuple<Ts...>() const {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return std::tuple<Ts...>(get<I>()...);
+        }(std::index_sequence_for<Refs...>());
+    }
+
+    // Element I, as an lvalue or rvalue as Refs[I] says.
+    template <std::size_t I>
+    constexpr std::tuple_element_t<I, std::tuple<Refs...>> get() const noexcept {
+        return static_cast<std::tuple_element_t<I, std::tuple<Refs...>>>(std::get<I>(refs_));
+    }
+
+    // Swaps the elements of two rows.
+    friend constexpr void swap(const zip_reference& lhs, const zip_reference& rhs)
+        requires(std::swappable<std::remove_reference_t<Refs>> && ...)
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (std::ranges::swap(std::get<I>(lhs.refs_), std::get<I>(rhs.refs_)), ...);
+        }(std::index_sequence_for<Refs...>());
+    }
+
+    template <detail::zip_like<sizeof...(Refs)> T>
+        requires detail::zip_equality_comparable<zip_reference, T>
+    friend constexpr bool operator==(const zip_reference& lhs, const T& rhs) {
+        return detail::zip_tie(lhs) == detail::zip_tie(rhs);
+    }
+
+    template <detail::zip_like<sizeof...(Refs)> T>
+        requires detail::zip_three_way_comparable<zip_reference, T>
+    friend constexpr auto operator<=>(const zip_reference& lhs, const T& rhs) {
+        return detail::zip_tie(lhs) <=> detail::zip_tie(rhs);
+    }
+
+  private:
+    template <class T, std::size_t... I>
+    constexpr zip_reference(T&& t, std::index_sequence<I...>) noexcept
+        : refs_(static_cast<Refs>(detail::zip_get<I>(std::forward<T>(t)))...) {}
+
+    template <class T>
+    constexpr void assign(T&& t) const {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((std::get<I>(refs_) = detail::zip_get<I>(std::forward<T>(t))), ...);
+        }(std::index_sequence_for<Refs...>());
+    }
+
+    std::tuple<Refs...> refs_;
+};
+
+template <std::size_t I, class... Refs>
+constexpr std::tuple_element_t<I, std::tuple<Refs...>> get(const zip_reference<Refs...>& r) noexcept {
+    return r.template get<I>();
+}
+
+namespace detail {
+// std::basic_common_reference for zip_references, given the element types of
+// both sides as std::tuples.
+template <template <class> class AQual, template <class> class BQual, class A, class B>
+struct zip_common_reference {};
+
+template <template <class> class AQual, template <class> class BQual, class... As, class... Bs>
+    requires requires { typename zip_reference<std::common_reference_t<AQual<As>, BQual<Bs>>...>; }
+struct zip_common_reference<AQual, BQual, std::tuple<As...>, std::tuple<Bs...>> {
+    using type = zip_reference<std::common_reference_t<AQual<As>, BQual<Bs>>...>;
+};
+} // namespace detail
+
+// An iterator over the rows of several columns, e.g. the std::vectors of a
+// structure of arrays, that dereferences to a zip_reference to the row's
+// elements.  It has the category of the weakest of Its, and all columns are
+// advanced together; iterators compare and subtract by their first column
+// only, so the columns must have the same length.
+//
+// Its iter_move and iter_swap hooks (see iterator_interface_access) move and
+// swap the elements column by column, so that algorithms such as
+// std::ranges::sort permute the rows in place, only materializing the rows
+// the algorithm holds in temporaries.  Where the standard library implements
+// the range algorithms with the classic ones, e.g. libstdc++ 12, those
+// temporaries are made with std::move(*it) and copy the elements instead, as
+// for std::tuple<T&...>.
+template <std::forward_iterator... Its>
+    requires(sizeof...(Its) > 0) && (std::is_reference_v<std::iter_reference_t<Its>> && ...)
+class zip_iterator : public ext_proxy_iterator_interface_compat<zip_iterator<Its...>,
+                                                                detail::zip_concept_t<Its...>,
+                                                                std::tuple<std::iter_value_t<Its>...>,
+                                                                zip_reference<std::iter_reference_t<Its>...>,
+                                                                std::common_type_t<std::iter_difference_t<Its>...>> {
+    using base_type = ext_proxy_iterator_interface_compat<zip_iterator<Its...>,
+                                                          detail::zip_concept_t<Its...>,
+                                                          std::tuple<std::iter_value_t<Its>...>,
+                                                          zip_reference<std::iter_reference_t<Its>...>,
+                                                          std::common_type_t<std::iter_difference_t<Its>...>>;
+
+  public:
+    using typename base_type::difference_type;
+    using typename base_type::reference;
+
+    zip_iterator() = default;
+    constexpr explicit zip_iterator(Its... its) : its_(std::move(its)...) {}
+
+    // The column iterators.
+    constexpr const std::tuple<Its...>& base() const& noexcept { return its_; }
+    constexpr std::tuple<Its...>        base() && { return std::move(its_); }
+
+    constexpr reference operator*() const {
+        return std::apply([](const auto&... it) { return reference(*it...); }, its_);
+    }
+
+    constexpr zip_iterator& operator++() {
+        std::apply([](auto&... it) { (++it, ...); }, its_);
+        return *this;
+    }
+
+    constexpr zip_iterator& operator--()
+        requires(std::bidirectional_iterator<Its> && ...)
+    {
+        std::apply([](auto&... it) { (--it, ...); }, its_);
+        return *this;
+    }
+
+    using base_type::operator++;
+    using base_type::operator--;
+
+    constexpr zip_iterator& operator+=(difference_type n)
+        requires(std::random_access_iterator<Its> && ...)
+    {
+        std::apply([n](auto&... it) { ((it += static_cast<std::iter_difference_t<Its>>(n)), ...); }, its_);
+        return *this;
+    }
+
+    friend constexpr difference_type operator-(const zip_iterator& lhs, const zip_iterator& rhs)
+        requires(std::random_access_iterator<Its> && ...)
+    {
+        return std::get<0>(lhs.its_) - std::get<0>(rhs.its_);
+    }
+
+    friend constexpr bool operator==(const zip_iterator& lhs, const zip_iterator& rhs) {
+        return std::get<0>(lhs.its_) == std::get<0>(rhs.its_);
+    }
+
+  private:
+    friend iterator_interface_access;
+
+    constexpr zip_reference<std::iter_rvalue_reference_t<Its>...> iter_move() const {
+        return std::apply(
+            [](const auto&... its) {
+                return zip_reference<std::iter_rvalue_reference_t<Its>...>(std::ranges::iter_move(its)...);
+            },
+            its_);
+    }
+
+    constexpr void iter_swap(const zip_iterator& other) const
+        requires(std::indirectly_swappable<Its> && ...)
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (std::ranges::iter_swap(std::get<I>(its_), std::get<I>(other.its_)), ...);
+        }(std::index_sequence_for<Its...>());
+    }
+
+    std::tuple<Its...> its_;
+};
+
+} // namespace iterator_interface
+} // namespace beman
+
+template <class... Refs>
+struct std::tuple_size<beman::iterator_interface::zip_reference<Refs...>>
+    : std::integral_constant<std::size_t, sizeof...(Refs)> {};
+
+template <std::size_t I, class... Refs>
+struct std::tuple_element<I, beman::iterator_interface::zip_reference<Refs...>>
+    : std::tuple_element<I, std::tuple<Refs...>> {};
+
+// The common reference of two rows is the row of the common references of
+// their elements, e.g. zip_reference<const T&...> for zip_reference<T&...>
+// and zip_reference<T&&...>, or zip_reference<T&...> for zip_reference<T&...>
+// and std::tuple<T...>&.
+template <class... Refs, class... Others, template <class> class RQual, template <class> class OQual>
+struct std::basic_common_reference<beman::iterator_interface::zip_reference<Refs...>,
+                                   beman::iterator_interface::zip_reference<Others...>,
+                                   RQual,
+                                   OQual>
+    : beman::iterator_interface::detail::
+          zip_common_reference<RQual, OQual, std::tuple<Refs...>, std::tuple<Others...>> {};
+
+template <class... Refs, class... Ts, template <class> class RQual, template <class> class TQual>
+struct std::basic_common_reference<beman::iterator_interface::zip_reference<Refs...>, std::tuple<Ts...>, RQual, TQual>
+    : beman::iterator_interface::detail::zip_common_reference<RQual, TQual, std::tuple<Refs...>, std::tuple<Ts...>> {};
+
+template <class... Ts, class... Refs, template <class> class TQual, template <class> class RQual>
+struct std::basic_common_reference<std::tuple<Ts...>, beman::iterator_interface::zip_reference<Refs...>, TQual, RQual>
+    : beman::iterator_interface::detail::zip_common_reference<TQual, RQual, std::tuple<Ts...>, std::tuple<Refs...>> {};
+
+#endif
@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/algorithm.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/iterator_interface.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+constexpr std::ptrdiff_t chunk_size = 8;
+
+// A deque-like random access iterator over fixed-size chunks.  The chunk map
+// carries a trailing null entry so that an iterator one past a full last chunk
+// is still representable as (segment, local).
+class chunked_iterator
+    : public ext_iterator_interface_compat<chunked_iterator, std::random_access_iterator_tag, int> {
+  public:
+    chunked_iterator() = default;
+    chunked_iterator(int* const* chunk, difference_type offset) : chunk_(chunk), offset_(offset) {}
+
+    int&              operator*() const { return (*chunk_)[offset_]; }
+    chunked_iterator& operator+=(difference_type n) {
+        offset_ += n;
+        difference_type chunks = offset_ / chunk_size;
+        offset_ %= chunk_size;
+        if (offset_ < 0) {
+            offset_ += chunk_size;
+            --chunks;
+        }
+        chunk_ += chunks;
+        return *this;
+    }
+    difference_type operator-(const chunked_iterator& other) const {
+        return (chunk_ - other.chunk_) * chunk_size + (offset_ - other.offset_);
+    }
+
+    // Incremented by compose() so tests can tell the segmented paths were taken.
+    static inline int compositions = 0;
+
+  private:
+    friend iterator_interface_access;
+
+    int* const* segment() const { return chunk_; }
+    int*        local() const { return *chunk_ + offset_; }
+
+    static int*             segment_begin(int* const* s) { return *s; }
+    static int*             segment_end(int* const* s) { return *s + chunk_size; }
+    static chunked_iterator compose(int* const* s, int* l) {
+        ++compositions;
+        return chunked_iterator(s, l - *s);
+    }
+
+    int* const*     chunk_  = nullptr;
+    difference_type offset_ = 0;
+};
+
+struct chunked_vector {
+    explicit chunked_vector(std::ptrdiff_t size) : size_(size) {
+        for (std::ptrdiff_t i = 0; i < (size + chunk_size - 1) / chunk_size; ++i) {
+            storage_.push_back(std::make_unique<int[]>(chunk_size));
+            map_.push_back(storage_.back().get());
+        }
+        map_.push_back(nullptr);
+        std::iota(begin(), end(), 0);
+    }
+
+    chunked_iterator begin() const { return chunked_iterator(map_.data(), 0); }
+    chunked_iterator end() const { return begin() + size_; }
+
+    std::vector<std::unique_ptr<int[]>> storage_;
+    std::vector<int*>                   map_;
+    std::ptrdiff_t                      size_;
+};
+
+} // namespace
+
+static_assert(std::random_access_iterator<chunked_iterator>);
+static_assert(segmented_iterator<chunked_iterator>);
+static_assert(std::same_as<segmented_iterator_traits<chunked_iterator>::local_iterator, int*>);
+static_assert(!segmented_iterator<int*>);
+static_assert(!segmented_iterator<std::vector<int>::iterator>);
+
+TEST(SegmentedAlgorithmTest, ForEach) {
+    const chunked_vector v(29);
+    for (std::ptrdiff_t first = 0; first <= v.size_; ++first) {
+        for (std::ptrdiff_t last = first; last <= v.size_; ++last) {
+            std::vector<int> visited;
+            algorithms::for_each(v.begin() + first, v.begin() + last, [&](int i) { visited.push_back(i); });
+            ASSERT_EQ(visited, std::vector<int>(v.begin() + first, v.begin() + last));
+        }
+    }
+}
+
+TEST(SegmentedAlgorithmTest, Copy) {
+    const chunked_vector v(32);
+    for (std::ptrdiff_t first = 0; first <= v.size_; ++first) {
+        for (std::ptrdiff_t last = first; last <= v.size_; ++last) {
+            std::vector<int> out(static_cast<std::size_t>(last - first) + 1, -1);
+            const auto       it = algorithms::copy(v.begin() + first, v.begin() + last, out.begin());
+            ASSERT_EQ(it, out.end() - 1);
+            ASSERT_TRUE(std::equal(out.begin(), it, v.begin() + first));
+            ASSERT_EQ(out.back(), -1);
+        }
+    }
+}
+
+TEST(SegmentedAlgorithmTest, Transform) {
+    const chunked_vector v(29);
+    const auto           twice = [](int i) { return 2 * i; };
+    for (std::ptrdiff_t first = 0; first <= v.size_; ++first) {
+        std::vector<int> out;
+        algorithms::transform(v.begin() + first, v.end(), std::back_inserter(out), twice);
+        std::vector<int> expected;
+        std::transform(v.begin() + first, v.end(), std::back_inserter(expected), twice);
+        ASSERT_EQ(out, expected);
+    }
+}
+
+TEST(SegmentedAlgorithmTest, Fill) {
+    const chunked_vector v(27);
+    algorithms::fill(v.begin() + 3, v.begin() + 20, 42);
+    for (std::ptrdiff_t i = 0; i < v.size_; ++i)
+        ASSERT_EQ(v.begin()[i], (i >= 3 && i < 20) ? 42 : i);
+}
+
+TEST(SegmentedAlgorithmTest, Find) {
+    const chunked_vector v(40);
+    for (std::ptrdiff_t first = 0; first <= v.size_; ++first) {
+        for (int value = -1; value <= v.size_; ++value) {
+            const auto it       = algorithms::find(v.begin() + first, v.end(), value);
+            const auto expected = std::find(v.begin() + first, v.end(), value);
+            ASSERT_EQ(it, expected);
+        }
+    }
+    chunked_iterator::compositions = 0;
+    ASSERT_EQ(*algorithms::find(v.begin(), v.end(), 17), 17);
+    ASSERT_EQ(chunked_iterator::compositions, 1);
+}
+
+TEST(SegmentedAlgorithmTest, Count) {
+    const chunked_vector v(50);
+    std::transform(v.begin(), v.end(), v.begin(), [](int i) { return i % 3; });
+    for (std::ptrdiff_t first = 0; first <= v.size_; first += 5) {
+        ASSERT_EQ(algorithms::count(v.begin() + first, v.end(), 1), std::count(v.begin() + first, v.end(), 1));
+    }
+}
+
+TEST(SegmentedAlgorithmTest, Equal) {
+    const chunked_vector v(30);
+    std::vector<int>     w(v.begin(), v.end());
+    for (std::ptrdiff_t first = 0; first <= v.size_; first += 3) {
+        ASSERT_TRUE(algorithms::equal(v.begin() + first, v.end(), w.begin() + first));
+        ASSERT_TRUE(algorithms::equal(v.begin() + first, v.end(), w.data() + first));
+    }
+    w[17] = -1;
+    ASSERT_FALSE(algorithms::equal(v.begin(), v.end(), w.begin()));
+    ASSERT_TRUE(algorithms::equal(v.begin(), v.begin() + 17, w.begin()));
+    const std::list<int> l(w.begin() + 18, w.end());
+    ASSERT_TRUE(algorithms::equal(v.begin() + 18, v.end(), l.begin()));
+}
+
+TEST(SegmentedAlgorithmTest, Accumulate) {
+    const chunked_vector v(100);
+    ASSERT_EQ(algorithms::accumulate(v.begin(), v.end(), 0), 4950);
+    ASSERT_EQ(algorithms::accumulate(v.begin() + 1, v.begin() + 5, 1, std::multiplies<>()), 24);
+    ASSERT_EQ(algorithms::accumulate(v.begin() + 9, v.begin() + 9, 7), 7);
+}
+
+namespace {
+
+// A contiguous iterator that counts calls to operator*.
+class counting_iterator
+    : public ext_iterator_interface_compat<counting_iterator, std::contiguous_iterator_tag, int> {
+  public:
+    counting_iterator() = default;
+    explicit counting_iterator(int* p) : p_(p) {}
+
+    int& operator*() const {
+        ++dereferences;
+        return *p_;
+    }
+
+    static inline int dereferences = 0;
+
+  private:
+    friend iterator_interface_access;
+    int*& base_reference() noexcept { return p_; }
+    int*  base_reference() const noexcept { return p_; }
+
+    int* p_ = nullptr;
+};
+
+} // namespace
+
+static_assert(std::contiguous_iterator<counting_iterator>);
+
+TEST(ContiguousAlgorithmTest, LowersToPointers) {
+    int               a[] = {5, 6, 7, 8, 6};
+    counting_iterator first(a);
+    counting_iterator last(a + 5);
+    counting_iterator::dereferences = 0;
+
+    std::vector<int> out(5);
+    ASSERT_EQ(algorithms::copy(first, last, out.begin()), out.end());
+    ASSERT_EQ(out, std::vector<int>({5, 6, 7, 8, 6}));
+
+    int b[5] = {};
+    ASSERT_EQ(algorithms::copy(out.begin(), out.end(), counting_iterator(b)), counting_iterator(b + 5));
+    ASSERT_TRUE(std::equal(a, a + 5, b));
+
+    ASSERT_EQ(algorithms::find(first, last, 7), first + 2);
+    ASSERT_EQ(algorithms::count(first, last, 6), 2);
+    ASSERT_EQ(algorithms::accumulate(first, last, 0), 32);
+    ASSERT_EQ(algorithms::transform(first, last, counting_iterator(b), [](int i) { return -i; }),
+              counting_iterator(b + 5));
+    ASSERT_EQ(b[3], -8);
+    algorithms::fill(first + 1, last, 0);
+    ASSERT_EQ(algorithms::accumulate(first, last, 0), 5);
+    ASSERT_EQ(counting_iterator::dereferences, 0);
+}
+
+namespace {
+
+// A random access iterator that also reads in bulk, like a block decoder.
+class bulk_source_iterator
+    : public ext_iterator_interface_compat<bulk_source_iterator, std::random_access_iterator_tag, const int> {
+  public:
+    bulk_source_iterator() = default;
+    explicit bulk_source_iterator(const int* p) : p_(p) {}
+
+    static inline int reads = 0;
+
+  private:
+    friend iterator_interface_access;
+    const int*& base_reference() noexcept { return p_; }
+    const int*  base_reference() const noexcept { return p_; }
+
+    int* read_n(int* out, difference_type n) {
+        ++reads;
+        out = std::copy(p_, p_ + n, out);
+        p_ += n;
+        return out;
+    }
+
+    const int* p_ = nullptr;
+};
+
+// An output iterator that writes in bulk, like a ring buffer.
+class bulk_sink_iterator
+    : public ext_iterator_interface_compat<bulk_sink_iterator, std::output_iterator_tag, int, int&> {
+  public:
+    bulk_sink_iterator() = default;
+    explicit bulk_sink_iterator(std::vector<int>& v) : v_(&v) {}
+
+    int& operator*() const { return v_->emplace_back(); }
+    bulk_sink_iterator& operator++() { return *this; }
+    bulk_sink_iterator  operator++(int) { return *this; }
+
+    static inline int writes = 0;
+
+  private:
+    friend iterator_interface_access;
+
+    template <std::input_iterator In>
+    In write_n(In in, difference_type n) {
+        ++writes;
+        for (; n > 0; --n, ++in)
+            v_->push_back(*in);
+        return in;
+    }
+
+    std::vector<int>* v_ = nullptr;
+};
+
+} // namespace
+
+static_assert(std::random_access_iterator<bulk_source_iterator>);
+static_assert(std::output_iterator<bulk_sink_iterator, int>);
+
+TEST(BulkAlgorithmTest, ReadN) {
+    const int        a[] = {1, 2, 3, 4, 5};
+    std::vector<int> out(5);
+
+    bulk_source_iterator::reads = 0;
+    ASSERT_EQ(algorithms::copy(bulk_source_iterator(a), bulk_source_iterator(a + 5), out.begin()), out.end());
+    ASSERT_EQ(out, std::vector<int>({1, 2, 3, 4, 5}));
+    ASSERT_EQ(algorithms::copy_n(bulk_source_iterator(a + 1), 3, out.begin()), out.begin() + 3);
+    ASSERT_EQ(out, std::vector<int>({2, 3, 4, 4, 5}));
+    ASSERT_EQ(algorithms::copy_n(bulk_source_iterator(a), 0, out.begin()), out.begin());
+    ASSERT_EQ(bulk_source_iterator::reads, 2);
+}
+
+TEST(BulkAlgorithmTest, WriteN) {
+    const std::vector<int> in{1, 2, 3};
+    std::vector<int>       out;
+
+    bulk_sink_iterator::writes = 0;
+    algorithms::copy(in.begin(), in.end(), bulk_sink_iterator(out));
+    algorithms::copy_n(in.begin() + 1, 2, bulk_sink_iterator(out));
+    algorithms::fill_n(bulk_sink_iterator(out), 2, 7);
+    ASSERT_EQ(out, std::vector<int>({1, 2, 3, 2, 3, 7, 7}));
+    ASSERT_EQ(bulk_sink_iterator::writes, 3);
+
+    // Segmented input: one write per segment.
+    const chunked_vector v(20);
+    out.clear();
+    bulk_sink_iterator::writes = 0;
+    algorithms::copy(v.begin() + 2, v.end(), bulk_sink_iterator(out));
+    ASSERT_EQ(out, std::vector<int>(v.begin() + 2, v.end()));
+    ASSERT_EQ(bulk_sink_iterator::writes, 3);
+}
+
+TEST(BulkAlgorithmTest, Fallback) {
+    std::vector<int> v(5);
+    ASSERT_EQ(algorithms::fill_n(v.begin(), 3, 9), v.begin() + 3);
+    ASSERT_EQ(v, std::vector<int>({9, 9, 9, 0, 0}));
+    std::vector<int> out;
+    algorithms::copy_n(v.begin(), 4, std::back_inserter(out));
+    ASSERT_EQ(out, std::vector<int>({9, 9, 9, 0}));
+    const chunked_vector c(12);
+    ASSERT_EQ(algorithms::fill_n(c.begin() + 1, 9, -1), c.begin() + 10);
+    ASSERT_EQ(algorithms::count(c.begin(), c.end(), -1), 9);
+}
+
+TEST(SegmentedAlgorithmTest, NonSegmentedFallback) {
+    std::vector<int> v{3, 1, 4, 1, 5};
+    ASSERT_EQ(algorithms::count(v.begin(), v.end(), 1), 2);
+    ASSERT_EQ(algorithms::find(v.begin(), v.end(), 4), v.begin() + 2);
+    ASSERT_EQ(algorithms::accumulate(v.begin(), v.end(), 0), 14);
+}
+
+} // namespace iterator_interface
+} // namespace beman
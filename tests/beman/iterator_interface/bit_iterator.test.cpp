@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/bit_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/bit_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <vector>
+
+// Whether argument-dependent lookup finds a count algorithm for It.
+template <class It>
+concept adl_finds_count = requires(It it) { count(it, it, true); };
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::random_access_iterator<bit_iterator<>>);
+static_assert(std::random_access_iterator<bit_iterator<const std::uint8_t>>);
+static_assert(std::output_iterator<bit_iterator<>, bool>);
+static_assert(std::same_as<std::iter_reference_t<bit_iterator<const std::uint64_t>>, bool>);
+static_assert(std::same_as<std::iter_value_t<bit_iterator<>>, bool>);
+static_assert(std::convertible_to<bit_iterator<>, bit_iterator<const std::uint64_t>>);
+static_assert(!std::convertible_to<bit_iterator<const std::uint64_t>, bit_iterator<>>);
+
+// The algorithm.hpp functions take the word-at-a-time paths.
+static_assert(detail::has_count<bit_iterator<const std::uint64_t>, bool>);
+static_assert(detail::has_find<bit_iterator<const std::uint64_t>, bool>);
+static_assert(detail::has_fill<bit_iterator<>, bool>);
+static_assert(!detail::has_fill<bit_iterator<const std::uint64_t>, bool>);
+static_assert(detail::has_equal<bit_iterator<>, bit_iterator<const std::uint64_t>>);
+static_assert(detail::bulk_readable<bit_iterator<const std::uint64_t>, bit_iterator<>>);
+
+// They are only found when asked for: argument-dependent lookup does not look
+// into namespace algorithms.
+static_assert(!adl_finds_count<bit_iterator<const std::uint64_t>>);
+
+namespace {
+
+constexpr std::ptrdiff_t size = 200;
+
+std::vector<std::uint64_t> random_words(unsigned seed) {
+    std::mt19937_64            gen(seed);
+    std::vector<std::uint64_t> words((size + 63) / 64);
+    for (auto& w : words)
+        w = gen() & gen(); // sparse-ish
+    return words;
+}
+
+std::vector<bool> to_bools(bit_iterator<const std::uint64_t> first, std::ptrdiff_t n) {
+    std::vector<bool> v;
+    for (std::ptrdiff_t i = 0; i != n; ++i)
+        v.push_back(first[i]);
+    return v;
+}
+
+} // namespace
+
+TEST(BitIteratorTest, Bits) {
+    std::uint64_t words[2] = {0b1011, 0};
+    auto          b        = bits(words, 128);
+    ASSERT_EQ(std::ranges::size(b), 128u);
+
+    auto it = b.begin();
+    ASSERT_TRUE(*it);
+    ASSERT_FALSE(it[2]);
+    ASSERT_TRUE(~it[2]);
+    it[2] = true;
+    ASSERT_EQ(words[0], 0b1111u);
+    it[64] = it[0];
+    ASSERT_EQ(words[1], 1u);
+    it[1].flip();
+    ASSERT_EQ(words[0], 0b1101u);
+    swap(it[1], it[64]);
+    ASSERT_EQ(words[0], 0b1111u);
+    ASSERT_EQ(words[1], 0u);
+    it += 100;
+    ASSERT_EQ(it.index(), 100);
+    ASSERT_EQ(b.end() - it, 28);
+
+    // Standard algorithms work bit by bit.
+    std::ranges::reverse(b);
+    ASSERT_EQ(words[0], 0u);
+    ASSERT_EQ(words[1], std::uint64_t(0b1111) << 60);
+}
+
+TEST(BitIteratorTest, CountFind) {
+    const auto                             words = random_words(1);
+    const bit_iterator<const std::uint64_t> b(words.data());
+    for (std::ptrdiff_t first = 0; first <= size; first += 7) {
+        for (std::ptrdiff_t last = first; last <= size; ++last) {
+            for (bool value : {false, true}) {
+                ASSERT_EQ(algorithms::count(b + first, b + last, value), std::count(b + first, b + last, value));
+                ASSERT_EQ(algorithms::find(b + first, b + last, value), std::find(b + first, b + last, value));
+            }
+        }
+    }
+}
+
+TEST(BitIteratorTest, Fill) {
+    for (std::ptrdiff_t first = 0; first <= size; first += 5) {
+        for (std::ptrdiff_t last = first; last <= size; last += 3) {
+            for (bool value : {false, true}) {
+                auto       words    = random_words(2);
+                auto       expected = to_bools(bit_iterator<const std::uint64_t>(words.data()), size);
+                const bit_iterator<> b(words.data());
+                algorithms::fill(b + first, b + last, value);
+                std::fill(expected.begin() + first, expected.begin() + last, value);
+                ASSERT_EQ(to_bools(b, size), expected);
+            }
+        }
+    }
+    std::uint64_t words[2] = {};
+    ASSERT_EQ(algorithms::fill_n(bit_iterator<>(words, 60), 8, true).index(), 68);
+    ASSERT_EQ(words[0], std::uint64_t(0xf) << 60);
+    ASSERT_EQ(words[1], 0xfu);
+}
+
+TEST(BitIteratorTest, CopyEqual) {
+    const auto                              source = random_words(3);
+    const bit_iterator<const std::uint64_t> in(source.data());
+    for (std::ptrdiff_t first = 0; first <= 70; first += 3) {
+        for (std::ptrdiff_t out_first = 0; out_first <= 70; out_first += 5) {
+            for (std::ptrdiff_t n : {0, 1, 50, 64, 65, 129}) {
+                auto       words    = random_words(4);
+                auto       expected = to_bools(bit_iterator<const std::uint64_t>(words.data()), size);
+                const bit_iterator<> out(words.data());
+                const auto end = algorithms::copy(in + first, in + first + n, out + out_first);
+                ASSERT_EQ(end, out + out_first + n);
+                std::copy(in + first, in + first + n, expected.begin() + out_first);
+                ASSERT_EQ(to_bools(out, size), expected);
+
+                ASSERT_TRUE(algorithms::equal(in + first, in + first + n, out + out_first));
+                if (n != 0) {
+                    (out + out_first + n - 1)[0].flip();
+                    ASSERT_FALSE(algorithms::equal(in + first, in + first + n, out + out_first));
+                }
+            }
+        }
+    }
+}
+
+TEST(BitIteratorTest, OtherWords) {
+    std::uint8_t bytes[3] = {0xff, 0x00, 0x0f};
+    const auto   b        = bits(static_cast<const std::uint8_t*>(bytes), 24);
+    ASSERT_EQ(algorithms::count(b.begin(), b.end(), true), 12);
+    ASSERT_EQ(algorithms::find(b.begin() + 3, b.end(), false).index(), 8);
+    ASSERT_EQ(algorithms::find(b.begin() + 9, b.end(), true).index(), 16);
+
+    std::uint8_t copy[3] = {};
+    algorithms::copy(b.begin() + 4, b.end(), bit_iterator<std::uint8_t>(copy, 2));
+    ASSERT_EQ(copy[0], 0x3c);
+    ASSERT_EQ(copy[1], 0xc0);
+    ASSERT_EQ(copy[2], 0x03);
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,76 @@
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+# cmake-format: off
+# tests/beman/iterator_interface/check_codegen.cmake -*-cmake-*-
+# cmake-format: on
+
+# Checks that the kernels in codegen_kernels.cpp compile to as many
+# instructions through iterator_interface as through a raw pointer.
+#
+# Usage: cmake -DASSEMBLY=<codegen_kernels assembly> -P check_codegen.cmake
+
+if(NOT ASSEMBLY)
+    message(FATAL_ERROR "ASSEMBLY is not set")
+endif()
+
+file(READ "${ASSEMBLY}" contents)
+# Keep list splitting on newlines only.
+string(REPLACE ";" "" contents "${contents}")
+string(REPLACE "\n" ";" lines "${contents}")
+
+set(kernels "")
+set(variants "")
+set(function "")
+foreach(line IN LISTS lines)
+    if(line MATCHES "^_?codegen_([a-z]+)_([a-z_]+):")
+        set(variant "${CMAKE_MATCH_1}")
+        set(kernel "${CMAKE_MATCH_2}")
+        set(function "${variant}_${kernel}")
+        set(count 0)
+        list(APPEND kernels "${kernel}")
+        list(APPEND variants "${variant}")
+    elseif(function)
+        if(line MATCHES "^[ \t]*\\.(cfi_endproc|size)")
+            set(count_${function} ${count})
+            set(function "")
+        elseif(line MATCHES "^[ \t]+[A-Za-z]")
+            # Instructions are indented; labels are not, and directives start with '.'.
+            math(EXPR count "${count} + 1")
+        endif()
+    endif()
+endforeach()
+
+list(REMOVE_DUPLICATES kernels)
+list(REMOVE_DUPLICATES variants)
+list(REMOVE_ITEM variants raw)
+if(NOT kernels OR NOT variants)
+    message(FATAL_ERROR "No codegen_<variant>_<kernel> functions found in ${ASSEMBLY}")
+endif()
+
+set(failed FALSE)
+foreach(kernel IN LISTS kernels)
+    if(NOT DEFINED count_raw_${kernel})
+        message(SEND_ERROR "${kernel}: missing raw pointer baseline")
+        set(failed TRUE)
+        continue()
+    endif()
+    foreach(variant IN LISTS variants)
+        if(NOT DEFINED count_${variant}_${kernel})
+            continue()
+        endif()
+        set(expected ${count_raw_${kernel}})
+        set(actual ${count_${variant}_${kernel}})
+        if(actual EQUAL expected)
+            message(STATUS "${kernel} [${variant}]: ${actual} instructions (raw: ${expected})")
+        else()
+            message(
+                SEND_ERROR
+                "${kernel} [${variant}]: ${actual} instructions, raw pointer version has ${expected}"
+            )
+            set(failed TRUE)
+        endif()
+    endforeach()
+endforeach()
+
+if(failed)
+    message(FATAL_ERROR "iterator_interface kernels are not equivalent to the raw pointer versions")
+endif()
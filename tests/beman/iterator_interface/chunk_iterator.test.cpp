@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/chunk_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/chunk_iterator.hpp>
+#include <beman/iterator_interface/transform_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::random_access_iterator<chunk_iterator<int*>>);
+static_assert(std::same_as<std::iter_reference_t<chunk_iterator<int*>>, std::span<int>>);
+static_assert(std::same_as<std::iter_reference_t<chunk_iterator<std::vector<int>::const_iterator>>,
+                           std::span<const int>>);
+static_assert(std::same_as<std::iter_reference_t<chunk_iterator<std::deque<int>::iterator>>,
+                           std::ranges::subrange<std::deque<int>::iterator>>);
+
+TEST(ChunkIteratorTest, Spans) {
+    std::vector<int> v(10);
+    std::iota(v.begin(), v.end(), 0);
+    auto c = chunks(v, 4);
+    ASSERT_EQ(std::ranges::size(c), 3u);
+
+    std::vector<std::size_t> sizes;
+    for (std::span<int> chunk : c)
+        sizes.push_back(chunk.size());
+    ASSERT_EQ(sizes, std::vector<std::size_t>({4, 4, 2}));
+
+    auto it = c.begin();
+    ASSERT_EQ(it[1][0], 4);
+    ASSERT_EQ((*(it + 2)).data(), v.data() + 8);
+    ASSERT_EQ(it->size(), 4u);
+    it += 3;
+    ASSERT_EQ(it, c.end());
+    ASSERT_EQ(it.base(), v.end());
+    ASSERT_EQ((*--it).size(), 2u);
+    ASSERT_EQ(it - c.begin(), 2);
+    ASSERT_EQ(it.base(), v.begin() + 8);
+
+    // The chunks are writable views of the range.
+    for (std::span<int> chunk : c)
+        std::ranges::fill(chunk, static_cast<int>(chunk.size()));
+    ASSERT_EQ(v, std::vector<int>({4, 4, 4, 4, 4, 4, 4, 4, 2, 2}));
+}
+
+TEST(ChunkIteratorTest, Subranges) {
+    std::deque<int> d(7, 1);
+    auto            c = chunks(d, 3);
+    ASSERT_EQ(std::ranges::size(c), 3u);
+    std::vector<int> sums;
+    for (auto it = c.end(); it != c.begin();) {
+        const auto chunk = *--it;
+        sums.push_back(std::accumulate(chunk.begin(), chunk.end(), 0));
+    }
+    ASSERT_EQ(sums, std::vector<int>({1, 3, 3}));
+
+    // Over an iterator_interface iterator.
+    std::vector<int> v{1, 2, 3, 4, 5};
+    transform_view   squares(v.begin(), v.end(), [](int i) { return i * i; });
+    auto             sc = chunks(squares, 2);
+    ASSERT_EQ(std::ranges::size(sc), 3u);
+    const auto last = *(sc.end() - 1);
+    ASSERT_EQ(std::vector<int>(last.begin(), last.end()), std::vector<int>({25}));
+}
+
+TEST(ChunkIteratorTest, Exact) {
+    std::vector<int> v(8);
+    ASSERT_EQ(std::ranges::size(chunks(v, 4)), 2u);
+    ASSERT_EQ(std::ranges::size(chunks(v, 8)), 1u);
+    ASSERT_EQ(std::ranges::size(chunks(v, 100)), 1u);
+    ASSERT_EQ((*chunks(v, 100).begin()).size(), 8u);
+
+    std::vector<int> empty;
+    ASSERT_TRUE(std::ranges::empty(chunks(empty, 4)));
+}
+
+} // namespace iterator_interface
+} // namespace beman
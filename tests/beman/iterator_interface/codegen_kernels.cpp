@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/codegen_kernels.cpp -*-C++-*-
+
+// Kernels for the codegen equivalence test, see check_codegen.cmake.  This
+// file is only compiled to assembly.  Each kernel is instantiated as
+// extern "C" codegen_<variant>_<kernel> once for a raw pointer and once per
+// iterator_interface implementation wrapping that pointer; every variant must
+// compile to as many instructions as codegen_raw_<kernel>.
+
+#include <beman/iterator_interface/iterator_interface.hpp>
+#include <beman/iterator_interface/detail/stl_interfaces/iterator_interface.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+
+namespace bii  = beman::iterator_interface;
+namespace crtp = beman::iterator_interface::detail::stl_interfaces::v2;
+
+using raw_iterator = const int*;
+
+// CRTP implementation, used when BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS() is off.
+class crtp_iterator : public crtp::iterator_interface<crtp_iterator, std::random_access_iterator_tag, const int> {
+  public:
+    crtp_iterator() = default;
+    explicit crtp_iterator(const int* p) : p_(p) {}
+
+  private:
+    friend bii::iterator_interface_access;
+    const int*& base_reference() noexcept { return p_; }
+    const int*  base_reference() const noexcept { return p_; }
+
+    const int* p_ = nullptr;
+};
+
+static_assert(sizeof(crtp_iterator) == sizeof(raw_iterator));
+static_assert(std::is_trivially_copyable_v<crtp_iterator>);
+static_assert(std::random_access_iterator<crtp_iterator>);
+
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+class deducing_iterator : public bii::iterator_interface<std::random_access_iterator_tag, const int> {
+  public:
+    deducing_iterator() = default;
+    explicit deducing_iterator(const int* p) : p_(p) {}
+
+  private:
+    friend bii::iterator_interface_access;
+    const int*& base_reference() noexcept { return p_; }
+    const int*  base_reference() const noexcept { return p_; }
+
+    const int* p_ = nullptr;
+};
+
+static_assert(sizeof(deducing_iterator) == sizeof(raw_iterator));
+static_assert(std::is_trivially_copyable_v<deducing_iterator>);
+static_assert(std::random_access_iterator<deducing_iterator>);
+#endif
+
+template <class It>
+long sum_increment(It first, It last) {
+    long sum = 0;
+    for (; first != last; ++first)
+        sum += *first;
+    return sum;
+}
+
+template <class It>
+long sum_subscript(It first, std::ptrdiff_t n) {
+    long sum = 0;
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+        sum += first[i];
+    return sum;
+}
+
+template <class It>
+long sum_three_way(It first, It last) {
+    long sum = 0;
+    for (; (first <=> last) < 0; ++first)
+        sum += *first;
+    return sum;
+}
+
+template <class It>
+long sum_difference(It first, It last) {
+    long sum = 0;
+    for (std::ptrdiff_t i = 0, n = last - first; i < n; ++i)
+        sum += *first++;
+    return sum;
+}
+
+template <class It>
+std::ptrdiff_t difference(It first, It last) {
+    return last - first;
+}
+
+} // namespace
+
+#define BEMAN_ITERATOR_INTERFACE_CODEGEN_KERNELS(variant, It)                                        \
+    extern "C" long codegen_##variant##_sum_increment(const int* first, const int* last) {           \
+        return sum_increment(It(first), It(last));                                                   \
+    }                                                                                                \
+    extern "C" long codegen_##variant##_sum_subscript(const int* first, std::ptrdiff_t n) {          \
+        return sum_subscript(It(first), n);                                                          \
+    }                                                                                                \
+    extern "C" long codegen_##variant##_sum_three_way(const int* first, const int* last) {           \
+        return sum_three_way(It(first), It(last));                                                   \
+    }                                                                                                \
+    extern "C" long codegen_##variant##_sum_difference(const int* first, const int* last) {          \
+        return sum_difference(It(first), It(last));                                                  \
+    }                                                                                                \
+    extern "C" std::ptrdiff_t codegen_##variant##_difference(const int* first, const int* last) {    \
+        return difference(It(first), It(last));                                                      \
+    }
+
+BEMAN_ITERATOR_INTERFACE_CODEGEN_KERNELS(raw, raw_iterator)
+BEMAN_ITERATOR_INTERFACE_CODEGEN_KERNELS(crtp, crtp_iterator)
+#if BEMAN_ITERATOR_INTERFACE_USE_DEDUCING_THIS()
+BEMAN_ITERATOR_INTERFACE_CODEGEN_KERNELS(deducing, deducing_iterator)
+#endif
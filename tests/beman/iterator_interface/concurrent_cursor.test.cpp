@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/concurrent_cursor.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/concurrent_cursor.hpp>
+
+#include <beman/iterator_interface/cyclic_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+TEST(ConcurrentCursorTest, GuidedChunks) {
+    std::vector<int>  v(1000);
+    concurrent_cursor cursor(v.begin(), v.end(), 4, 8);
+
+    std::vector<std::ptrdiff_t> sizes;
+    auto                        expected_begin = v.begin();
+    for (auto chunk = cursor.claim(); !chunk.empty(); chunk = cursor.claim()) {
+        ASSERT_EQ(chunk.begin(), expected_begin);
+        expected_begin = chunk.end();
+        sizes.push_back(std::ranges::ssize(chunk));
+    }
+    ASSERT_EQ(expected_begin, v.end());
+    ASSERT_EQ(cursor.remaining(), 0);
+    ASSERT_TRUE(cursor.claim().empty());
+
+    // remaining / 8, shrinking down to the minimum of 8.
+    ASSERT_EQ(sizes.front(), 125);
+    ASSERT_TRUE(std::is_sorted(sizes.rbegin(), sizes.rend()));
+    ASSERT_EQ(sizes[sizes.size() - 2], 8);
+    ASSERT_LE(sizes.back(), 8);
+}
+
+TEST(ConcurrentCursorTest, FixedChunks) {
+    int                    period[3] = {1, 2, 3};
+    cyclic_iterator<int>   first(period, 3);
+    concurrent_cursor      cursor(first, first + 10, 1);
+    std::vector<long long> sums;
+    for (auto chunk = cursor.claim(4); !chunk.empty(); chunk = cursor.claim(4))
+        sums.push_back(std::accumulate(chunk.begin(), chunk.end(), 0LL));
+    // 1 2 3 1 | 2 3 1 2 | 3 1
+    ASSERT_EQ(sums, std::vector<long long>({7, 8, 4}));
+}
+
+TEST(ConcurrentCursorTest, EveryElementClaimedOnce) {
+    constexpr int     threads = 8;
+    std::vector<int>  claimed(100000);
+    concurrent_cursor cursor(claimed.begin(), claimed.end(), threads);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&cursor] {
+            for (auto chunk = cursor.claim(); !chunk.empty(); chunk = cursor.claim()) {
+                for (int& i : chunk)
+                    ++i;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    ASSERT_TRUE(std::all_of(claimed.begin(), claimed.end(), [](int i) { return i == 1; }));
+}
+
+} // namespace iterator_interface
+} // namespace beman
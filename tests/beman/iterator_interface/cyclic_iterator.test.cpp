@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/cyclic_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/cyclic_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::random_access_iterator<cyclic_iterator<const char>>);
+static_assert(std::random_access_iterator<cyclic_iterator<int>>);
+static_assert(std::output_iterator<cyclic_iterator<int>, int>);
+
+namespace {
+// The sequence a cyclic_iterator over period is expected to produce.
+std::string tiled(std::string_view period, std::ptrdiff_t pos, std::ptrdiff_t n) {
+    std::string s;
+    for (std::ptrdiff_t i = pos; i < pos + n; ++i)
+        s += period[static_cast<std::size_t>(i % static_cast<std::ptrdiff_t>(period.size()))];
+    return s;
+}
+} // namespace
+
+TEST(CyclicIteratorTest, Navigation) {
+    constexpr std::string_view  period = "abcde";
+    cyclic_iterator<const char> it(period.data(), 5, 3);
+    ASSERT_EQ(*it, 'd');
+    ASSERT_EQ(*++it, 'e');
+    ASSERT_EQ(*++it, 'a');
+    ASSERT_EQ(*--it, 'e');
+    ASSERT_EQ(*it--, 'e');
+    ASSERT_EQ(*it, 'd');
+    ASSERT_EQ(it[4], 'c');
+    ASSERT_EQ(it[-4], 'e');
+    ASSERT_EQ(*(it + 12), 'a');
+    ASSERT_EQ(*(it - 13), 'a');
+    ASSERT_EQ((it + 12) - it, 12);
+    ASSERT_EQ((it + 12).position(), 15);
+    ASSERT_TRUE(it < it + 1);
+    ASSERT_EQ(it + 5, it - -5);
+    ASSERT_NE(it + 5, it);
+
+    for (std::ptrdiff_t n = -12; n <= 12; ++n) {
+        auto jumped = it;
+        jumped += n;
+        auto stepped = it;
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+            ++stepped;
+        for (std::ptrdiff_t i = 0; i > n; --i)
+            --stepped;
+        ASSERT_EQ(*jumped, *stepped);
+        ASSERT_EQ(jumped, stepped);
+    }
+}
+
+TEST(CyclicIteratorTest, CopyUsesPeriods) {
+    for (std::string_view period : {"x", "foo", "abcdefghijklmnopqrstuvwxyz"}) {
+        const auto size = static_cast<std::ptrdiff_t>(period.size());
+        for (std::ptrdiff_t pos : {0, 1, 2, 25}) {
+            for (std::ptrdiff_t n : {0, 1, 2, 3, 7, 26, 27, 100, 1000}) {
+                const cyclic_iterator<const char> first(period.data(), size, pos);
+
+                std::string out(static_cast<std::size_t>(n), '\0');
+                ASSERT_EQ(algorithms::copy(first, first + n, out.begin()), out.end());
+                ASSERT_EQ(out, tiled(period, pos, n));
+
+                std::vector<char> v(static_cast<std::size_t>(n));
+                ASSERT_EQ(algorithms::copy_n(first, n, v.data()), v.data() + n);
+                ASSERT_TRUE(std::equal(v.begin(), v.end(), out.begin()));
+
+                std::list<char> l;
+                algorithms::copy(first, first + n, std::back_inserter(l));
+                ASSERT_TRUE(std::equal(l.begin(), l.end(), out.begin(), out.end()));
+            }
+        }
+    }
+}
+
+TEST(CyclicIteratorTest, WriteKeepsLastPeriod) {
+    std::vector<int>     ring(4, -1);
+    cyclic_iterator<int> it(ring.data(), 4, 2);
+    std::vector<int>     in{1, 2, 3};
+    it = algorithms::copy(in.begin(), in.end(), it);
+    ASSERT_EQ(ring, std::vector<int>({3, -1, 1, 2}));
+    ASSERT_EQ(it.position(), 5);
+
+    std::vector<int> many(11);
+    std::iota(many.begin(), many.end(), 10);
+    it = algorithms::copy(many.begin(), many.end(), it);
+    ASSERT_EQ(it.position(), 16);
+    ASSERT_EQ(ring, std::vector<int>({17, 18, 19, 20}));
+
+    std::list<int> l{1, 2, 3, 4, 5, 6};
+    it = algorithms::copy_n(l.begin(), 6, it);
+    ASSERT_EQ(ring, std::vector<int>({5, 6, 3, 4}));
+
+    it = algorithms::fill_n(it, 1000, 7);
+    ASSERT_EQ(it.position(), 1022);
+    ASSERT_EQ(ring, std::vector<int>({7, 7, 7, 7}));
+    algorithms::fill(it, it + 3, 8);
+    ASSERT_EQ(ring, std::vector<int>({8, 7, 8, 8}));
+}
+
+} // namespace iterator_interface
+} // namespace beman
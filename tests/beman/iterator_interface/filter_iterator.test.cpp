@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/filter_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/filter_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+struct is_even {
+    bool operator()(int i) const { return i % 2 == 0; }
+};
+
+using less_than = value_predicate<std::less<>, int>;
+
+} // namespace
+
+static_assert(std::forward_iterator<filter_iterator<std::forward_list<int>::iterator, is_even>>);
+static_assert(!std::bidirectional_iterator<filter_iterator<std::forward_list<int>::iterator, is_even>>);
+static_assert(std::bidirectional_iterator<filter_iterator<int*, is_even>>);
+static_assert(!std::random_access_iterator<filter_iterator<int*, is_even>>);
+static_assert(!std::sized_sentinel_for<filter_iterator<int*, is_even>, filter_iterator<int*, is_even>>);
+static_assert(std::ranges::bidirectional_range<filter_view<int*, is_even>>);
+
+// The end of the range and the predicate live in the view.
+static_assert(sizeof(filter_iterator<int*, is_even>) == 2 * sizeof(int*));
+static_assert(sizeof(filter_iterator<int*, less_than>) == 2 * sizeof(int*));
+
+static_assert(enable_block_search<less_than>);
+static_assert(enable_block_search<value_predicate<std::equal_to<>, char>>);
+static_assert(!enable_block_search<is_even>);
+
+TEST(FilterIteratorTest, Forward) {
+    std::forward_list<int> l{1, 2, 3, 4, 10, 11, 101, 200, 0};
+    filter_view            v(l.begin(), l.end(), is_even{});
+    ASSERT_EQ(std::vector<int>(v.begin(), v.end()), std::vector<int>({2, 4, 10, 200, 0}));
+
+    auto it = v.begin();
+    ASSERT_EQ(*it++, 2);
+    ASSERT_EQ(*it, 4);
+    ASSERT_EQ(it.base(), std::next(l.begin(), 3));
+    ASSERT_EQ(std::ranges::distance(v), 5);
+}
+
+TEST(FilterIteratorTest, Bidirectional) {
+    std::list<int>   l{1, 2, 3, 4, 5, 6, 7};
+    filter_view      v(l.begin(), l.end(), is_even{});
+    std::vector<int> reversed;
+    for (auto it = v.end(); it != v.begin();)
+        reversed.push_back(*--it);
+    ASSERT_EQ(reversed, std::vector<int>({6, 4, 2}));
+    auto it = std::next(v.begin());
+    ASSERT_EQ(*it--, 4);
+    ASSERT_EQ(*it, 2);
+}
+
+TEST(FilterIteratorTest, Empty) {
+    std::vector<int> a{1, 3, 5};
+    filter_view      v(a.begin(), a.end(), is_even{});
+    ASSERT_TRUE(v.empty());
+    ASSERT_EQ(v.begin(), v.end());
+}
+
+TEST(FilterIteratorTest, Arrow) {
+    struct point {
+        int x;
+        int y;
+    };
+    std::vector<point> a{{1, 2}, {2, 3}, {4, 5}};
+    filter_view        v(a.begin(), a.end(), [](const point& p) { return p.x % 2 == 0; });
+    ASSERT_EQ(v.begin()->y, 3);
+}
+
+TEST(FilterIteratorTest, BlockSearch) {
+    // Sparse matches at every offset relative to the block boundaries, so
+    // both the block loop and the tail loop find and skip them.
+    for (int size : {0, 1, 15, 16, 17, 63, 64, 65, 200}) {
+        for (int step : {1, 7, 16, 64, 1000}) {
+            std::vector<int> a(static_cast<std::size_t>(size));
+            for (int i = 0; i < size; ++i)
+                a[static_cast<std::size_t>(i)] = i % step == step - 1 ? 0 : 1;
+
+            const filter_view blocked(a.data(), a.data() + a.size(), less_than{std::less<>(), 1});
+            const filter_view scalar(a.data(), a.data() + a.size(), [](int i) { return i < 1; });
+            std::vector<int*> expected;
+            for (auto it = scalar.begin(); it != scalar.end(); ++it)
+                expected.push_back(it.base());
+            std::vector<int*> actual;
+            for (auto it = blocked.begin(); it != blocked.end(); ++it)
+                actual.push_back(it.base());
+            ASSERT_EQ(actual, expected) << "size " << size << ", step " << step;
+        }
+    }
+}
+
+TEST(FilterIteratorTest, BlockSearchChars) {
+    const char  s[] = "the quick brown fox jumps over the lazy dog, then keeps running for a while";
+    filter_view v(std::begin(s), std::end(s) - 1, value_predicate(std::equal_to<>(), ' '));
+    ASSERT_EQ(std::ranges::distance(v), std::count(std::begin(s), std::end(s), ' '));
+    ASSERT_EQ(*std::ranges::next(v.begin(), 13).base(), ' ');
+    ASSERT_EQ(std::ranges::next(v.begin(), 13).base() - s, 69);
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -8,7 +8,12 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace beman {
 namespace iterator_interface {
@@ -198,5 +203,462 @@ struct dummy_input_iterator : public ext_iterator_interface_compat<dummy_input_i
 static_assert(std::input_iterator<dummy_input_iterator>);
 static_assert(!std::forward_iterator<dummy_input_iterator>);
 
+template <typename T>
+struct pointer_iterator
+    : ext_iterator_interface_compat<pointer_iterator<T>, std::contiguous_iterator_tag, T> {
+    constexpr pointer_iterator() = default;
+    constexpr explicit pointer_iterator(T* p) : p_(p) {}
+
+  private:
+    friend iterator_interface_access;
+    constexpr T*& base_reference() noexcept { return p_; }
+    constexpr T*  base_reference() const noexcept { return p_; }
+
+    T* p_ = nullptr;
+};
+
+// Contiguous without base_reference(); supplies the address through the to_address() hook instead.
+struct indexed_iterator
+    : ext_iterator_interface_compat<indexed_iterator, std::contiguous_iterator_tag, int> {
+    constexpr indexed_iterator() = default;
+    constexpr indexed_iterator(int* data, difference_type i) : data_(data), i_(i) {}
+
+    constexpr int&              operator*() const { return data_[i_]; }
+    constexpr indexed_iterator& operator+=(difference_type n) {
+        i_ += n;
+        return *this;
+    }
+    constexpr difference_type operator-(indexed_iterator other) const { return i_ - other.i_; }
+
+  private:
+    friend iterator_interface_access;
+    constexpr int* to_address() const noexcept { return data_ + i_; }
+
+    int*            data_ = nullptr;
+    difference_type i_    = 0;
+};
+
+static_assert(std::contiguous_iterator<pointer_iterator<int>>);
+static_assert(std::contiguous_iterator<pointer_iterator<const int>>);
+static_assert(std::contiguous_iterator<indexed_iterator>);
+static_assert(std::same_as<pointer_iterator<int>::element_type, int>);
+static_assert(std::same_as<pointer_iterator<const int>::element_type, const int>);
+static_assert(std::same_as<std::iter_value_t<pointer_iterator<const int>>, int>);
+static_assert(std::same_as<std::iterator_traits<pointer_iterator<int>>::iterator_category,
+                           std::random_access_iterator_tag>);
+template <typename T>
+concept has_element_type = requires { typename T::element_type; };
+static_assert(!has_element_type<repeated_chars_iterator>);
+
+TEST(IteratorTest, ContiguousToAddress) {
+    auto lambda = [] {
+        int                   a[3] = {1, 2, 3};
+        pointer_iterator<int> first(a);
+        pointer_iterator<int> last(a + 3);
+        indexed_iterator      ifirst(a, 0);
+        indexed_iterator      ilast(a, 3);
+        // Dereferencing past-the-end iterators is not a constant expression, so
+        // these also check that operator-> does not go through operator*.
+        CONSTEXPR_EXPECT_EQ(std::to_address(last), a + 3);
+        CONSTEXPR_EXPECT_EQ(std::to_address(ilast), a + 3);
+        CONSTEXPR_EXPECT_EQ(std::to_address(first + 1), &a[1]);
+        CONSTEXPR_EXPECT_EQ(std::to_address(ifirst + 2), &a[2]);
+        CONSTEXPR_EXPECT_EQ(first.operator->(), a);
+    };
+
+    static_assert((lambda(), true));
+    lambda();
+}
+
+TEST(IteratorTest, ContiguousSpan) {
+    int                         a[] = {1, 2, 3, 4};
+    pointer_iterator<const int> first(a);
+    pointer_iterator<const int> last(a + 4);
+    std::span<const int>        s(first, last);
+    ASSERT_EQ(s.data(), a);
+    ASSERT_EQ(s.size(), 4u);
+
+    std::span<int> t(indexed_iterator(a, 1), indexed_iterator(a, 3));
+    ASSERT_EQ(t.data(), a + 1);
+    ASSERT_EQ(t.size(), 2u);
+}
+
+// A proxy reference that counts how often it is copied or moved.
+struct counted_proxy {
+    static inline int copies = 0;
+
+    constexpr explicit counted_proxy(int& v) : value(&v) {}
+    counted_proxy(const counted_proxy& other) : value(other.value) { ++copies; }
+    counted_proxy(counted_proxy&& other) : value(other.value) { ++copies; }
+
+    constexpr int get() const { return *value; }
+    constexpr     operator int() const { return *value; }
+
+    int* value;
+};
+
+struct counted_proxy_iterator : ext_proxy_iterator_interface_compat<counted_proxy_iterator,
+                                                                   std::random_access_iterator_tag,
+                                                                   int,
+                                                                   counted_proxy> {
+    constexpr counted_proxy_iterator() = default;
+    constexpr explicit counted_proxy_iterator(int* p) : p_(p) {}
+
+    constexpr counted_proxy operator*() const { return counted_proxy(*p_); }
+
+  private:
+    friend iterator_interface_access;
+    constexpr int*& base_reference() noexcept { return p_; }
+    constexpr int*  base_reference() const noexcept { return p_; }
+
+    int* p_ = nullptr;
+};
+
+// Supplies operator-> through the arrow() hook, here a pointer into the
+// iterator's own cache.
+struct cached_arrow_iterator
+    : ext_iterator_interface_compat<cached_arrow_iterator, std::forward_iterator_tag, int, int, const int*> {
+    using base_type =
+        ext_iterator_interface_compat<cached_arrow_iterator, std::forward_iterator_tag, int, int, const int*>;
+
+    constexpr cached_arrow_iterator() = default;
+    constexpr explicit cached_arrow_iterator(int i) : i_(i) {}
+
+    constexpr int                    operator*() const { return i_; }
+    constexpr cached_arrow_iterator& operator++() {
+        ++i_;
+        return *this;
+    }
+    using base_type::operator++;
+
+    friend constexpr bool operator==(cached_arrow_iterator lhs, cached_arrow_iterator rhs) { return lhs.i_ == rhs.i_; }
+
+  private:
+    friend iterator_interface_access;
+    constexpr const int* arrow() const noexcept { return &i_; }
+
+    int i_ = 0;
+};
+
+static_assert(std::random_access_iterator<counted_proxy_iterator>);
+static_assert(std::forward_iterator<cached_arrow_iterator>);
+
+TEST(IteratorTest, ProxyArrowInPlace) {
+    int                    a[] = {1, 2, 3};
+    counted_proxy_iterator it(a);
+    counted_proxy::copies = 0;
+    ASSERT_EQ(it->get(), 1);
+    ASSERT_EQ((it + 2)->get(), 3);
+    ASSERT_EQ(counted_proxy::copies, 0);
+    // The converting constructors still copy or move.
+    proxy_arrow_result<counted_proxy> copied(*it);
+    ASSERT_EQ(copied->get(), 1);
+    ASSERT_EQ(counted_proxy::copies, 1);
+}
+
+TEST(IteratorTest, ArrowHook) {
+    // int is neither a reference nor constructible into const int*, so
+    // operator-> only exists because of the hook.
+    const cached_arrow_iterator it(4);
+    ASSERT_EQ(it.operator->(), it.operator->());
+    ASSERT_EQ(*it.operator->(), 4);
+    ASSERT_EQ(*std::next(it).operator->(), 5);
+}
+
+// Counts its copies, which makes it neither trivially copyable nor cheap to
+// compare by value.
+struct copy_counting_iterator
+    : ext_iterator_interface_compat<copy_counting_iterator, std::random_access_iterator_tag, int> {
+    static inline int copies = 0;
+
+    copy_counting_iterator() = default;
+    explicit copy_counting_iterator(int* p) : p_(p) {}
+    copy_counting_iterator(const copy_counting_iterator& other) : p_(other.p_) { ++copies; }
+    copy_counting_iterator& operator=(const copy_counting_iterator& other) {
+        p_ = other.p_;
+        ++copies;
+        return *this;
+    }
+
+  private:
+    friend iterator_interface_access;
+    int*& base_reference() noexcept { return p_; }
+    int*  base_reference() const noexcept { return p_; }
+
+    int* p_ = nullptr;
+};
+
+// Heavy, with a base_reference() that only works on non-const iterators, as
+// in the filtered_int_iterator example: compared through copies.
+struct mutable_base_iterator
+    : ext_iterator_interface_compat<mutable_base_iterator, std::random_access_iterator_tag, int> {
+    mutable_base_iterator() = default;
+    explicit mutable_base_iterator(int* p) : p_(p) {}
+
+  private:
+    friend iterator_interface_access;
+    int*& base_reference() noexcept { return p_; }
+
+    int*             p_ = nullptr;
+    std::vector<int> payload_;
+};
+
+static_assert(std::random_access_iterator<copy_counting_iterator>);
+
+TEST(IteratorTest, HeavyIteratorComparisonsDoNotCopy) {
+    int                          a[4] = {};
+    const copy_counting_iterator first(a);
+    const copy_counting_iterator last(a + 4);
+    copy_counting_iterator::copies = 0;
+    ASSERT_TRUE(first != last);
+    ASSERT_FALSE(first == last);
+    ASSERT_TRUE(first < last);
+    ASSERT_TRUE(first <= last);
+    ASSERT_FALSE(first > last);
+    ASSERT_FALSE(first >= last);
+    ASSERT_EQ(first <=> last, std::strong_ordering::less);
+    ASSERT_EQ(last - first, 4);
+    ASSERT_EQ(copy_counting_iterator::copies, 0);
+}
+
+TEST(IteratorTest, MutableBaseReferenceComparisons) {
+    int                         a[4] = {};
+    const mutable_base_iterator first(a);
+    const mutable_base_iterator last(a + 4);
+    ASSERT_TRUE(first != last);
+    ASSERT_TRUE(first < last);
+    ASSERT_EQ(last - first, 4);
+}
+
+// Generated operators are noexcept exactly when the operations they are
+// built on are.
+struct throwing_advance_iterator
+    : ext_iterator_interface_compat<throwing_advance_iterator, std::random_access_iterator_tag, int> {
+    throwing_advance_iterator() = default;
+    explicit throwing_advance_iterator(int* p) : p_(p) {}
+
+    int&                       operator*() const noexcept { return *p_; }
+    throwing_advance_iterator& operator+=(difference_type n) {
+        p_ += n;
+        return *this;
+    }
+    difference_type operator-(const throwing_advance_iterator& other) const noexcept { return p_ - other.p_; }
+
+  private:
+    int* p_ = nullptr;
+};
+
+static_assert(std::random_access_iterator<throwing_advance_iterator>);
+
+template <class It>
+concept nothrow_random_access = requires(It it, const It cit, typename It::difference_type n) {
+    requires noexcept(*cit);
+    requires noexcept(cit.operator->());
+    requires noexcept(cit[n]);
+    requires noexcept(++it);
+    requires noexcept(it++);
+    requires noexcept(--it);
+    requires noexcept(it--);
+    requires noexcept(it += n);
+    requires noexcept(it -= n);
+    requires noexcept(cit + n);
+    requires noexcept(n + cit);
+    requires noexcept(cit - n);
+    requires noexcept(cit - cit);
+    requires noexcept(cit == cit);
+    requires noexcept(cit != cit);
+    requires noexcept(cit < cit);
+    requires noexcept(cit <= cit);
+    requires noexcept(cit > cit);
+    requires noexcept(cit >= cit);
+    requires noexcept(cit <=> cit);
+};
+
+static_assert(nothrow_random_access<pointer_iterator<int>>);
+static_assert(!nothrow_random_access<indexed_iterator>);
+static_assert(noexcept(std::declval<const pointer_iterator<int>&>() + 1));
+static_assert(noexcept(std::declval<const pointer_iterator<int>&>()[1]));
+static_assert(!noexcept(std::declval<const indexed_iterator&>() + 1));
+static_assert(!noexcept(std::declval<const indexed_iterator&>()[1]));
+static_assert(!noexcept(++std::declval<indexed_iterator&>()));
+static_assert(!noexcept(std::declval<const indexed_iterator&>() < std::declval<const indexed_iterator&>()));
+static_assert(std::is_nothrow_copy_constructible_v<pointer_iterator<int>>);
+
+// Only the operations that copy copy_counting_iterator can throw.
+static_assert(noexcept(*std::declval<const copy_counting_iterator&>()));
+static_assert(noexcept(++std::declval<copy_counting_iterator&>()));
+static_assert(noexcept(std::declval<copy_counting_iterator&>() += 1));
+static_assert(noexcept(std::declval<const copy_counting_iterator&>() ==
+                       std::declval<const copy_counting_iterator&>()));
+static_assert(noexcept(std::declval<const copy_counting_iterator&>() < std::declval<const copy_counting_iterator&>()));
+static_assert(noexcept(std::declval<const copy_counting_iterator&>() - std::declval<const copy_counting_iterator&>()));
+static_assert(!noexcept(std::declval<copy_counting_iterator&>()++));
+static_assert(!noexcept(std::declval<const copy_counting_iterator&>() + 1));
+static_assert(!noexcept(std::declval<const copy_counting_iterator&>()[1]));
+
+// Increments and jumps go through the throwing operator+=.
+static_assert(noexcept(*std::declval<const throwing_advance_iterator&>()));
+static_assert(!noexcept(++std::declval<throwing_advance_iterator&>()));
+static_assert(!noexcept(--std::declval<throwing_advance_iterator&>()));
+static_assert(!noexcept(std::declval<throwing_advance_iterator&>() -= 1));
+static_assert(!noexcept(std::declval<const throwing_advance_iterator&>() + 1));
+static_assert(!noexcept(std::declval<const throwing_advance_iterator&>()[1]));
+static_assert(noexcept(std::declval<const throwing_advance_iterator&>() ==
+                       std::declval<const throwing_advance_iterator&>()));
+static_assert(noexcept(std::declval<const throwing_advance_iterator&>() <=>
+                       std::declval<const throwing_advance_iterator&>()));
+
+// The to_address() hook, and operator-> through it, are noexcept when the
+// iterator's to_address() is.
+struct throwing_address_iterator
+    : ext_iterator_interface_compat<throwing_address_iterator, std::contiguous_iterator_tag, int> {
+    throwing_address_iterator() = default;
+    explicit throwing_address_iterator(int* p) : p_(p) {}
+
+    int&                       operator*() const noexcept { return *p_; }
+    throwing_address_iterator& operator+=(difference_type n) noexcept {
+        p_ += n;
+        return *this;
+    }
+    difference_type operator-(const throwing_address_iterator& other) const noexcept { return p_ - other.p_; }
+
+  private:
+    friend iterator_interface_access;
+    int* to_address() const { return p_; }
+
+    int* p_ = nullptr;
+};
+
+static_assert(std::contiguous_iterator<throwing_address_iterator>);
+static_assert(noexcept(iterator_interface_access::to_address(std::declval<const indexed_iterator&>())));
+static_assert(noexcept(std::declval<const indexed_iterator&>().operator->()));
+static_assert(
+    !noexcept(iterator_interface_access::to_address(std::declval<const throwing_address_iterator&>())));
+static_assert(!noexcept(std::declval<const throwing_address_iterator&>().operator->()));
+
+static_assert(noexcept(std::declval<const cached_arrow_iterator&>().operator->()));
+
+// An element that counts how often it is copied and moved.
+struct tracked {
+    static inline int copies = 0;
+    static inline int moves  = 0;
+
+    tracked() = default;
+    explicit tracked(int v) : value(v) {}
+    tracked(const tracked& other) : value(other.value) { ++copies; }
+    tracked(tracked&& other) noexcept : value(other.value) { ++moves; }
+    tracked& operator=(const tracked& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    tracked& operator=(tracked&& other) noexcept {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+
+    int value = 0;
+};
+
+// A proxy reference to a tracked element; assignments go to the element.
+struct tracked_ref {
+    explicit tracked_ref(tracked* p) : element(p) {}
+    tracked_ref(const tracked_ref&) = default;
+    operator tracked() const { return *element; }
+    const tracked_ref& operator=(const tracked_ref& other) const {
+        *element = *other.element;
+        return *this;
+    }
+    const tracked_ref& operator=(const tracked& t) const {
+        *element = t;
+        return *this;
+    }
+    const tracked_ref& operator=(tracked&& t) const {
+        *element = std::move(t);
+        return *this;
+    }
+
+    tracked* element;
+};
+
+// A proxy iterator over tracked elements that supplies iter_move and
+// iter_swap through iterator_interface_access when Hooks is true.
+template <bool Hooks>
+struct tracked_iterator : ext_proxy_iterator_interface_compat<tracked_iterator<Hooks>,
+                                                             std::random_access_iterator_tag,
+                                                             tracked,
+                                                             tracked_ref> {
+    tracked_iterator() = default;
+    explicit tracked_iterator(tracked* p) : p_(p) {}
+
+    tracked_ref operator*() const { return tracked_ref(p_); }
+
+  private:
+    friend iterator_interface_access;
+    tracked*& base_reference() noexcept { return p_; }
+    tracked*  base_reference() const noexcept { return p_; }
+
+    tracked&& iter_move() const noexcept
+        requires Hooks
+    {
+        return std::move(*p_);
+    }
+    void iter_swap(const tracked_iterator& other) const noexcept
+        requires Hooks
+    {
+        std::ranges::swap(*p_, *other.p_);
+    }
+
+    tracked* p_ = nullptr;
+};
+
+static_assert(std::same_as<std::iter_rvalue_reference_t<tracked_iterator<false>>, tracked_ref>);
+static_assert(std::same_as<std::iter_rvalue_reference_t<tracked_iterator<true>>, tracked&&>);
+static_assert(noexcept(std::ranges::iter_move(std::declval<const tracked_iterator<true>&>())));
+
+TEST(IteratorTest, IterMoveHook) {
+    tracked a[] = {tracked(1), tracked(2), tracked(3), tracked(4)};
+
+    tracked::copies = tracked::moves = 0;
+    const tracked copied             = std::ranges::iter_move(tracked_iterator<false>(a));
+    ASSERT_EQ(copied.value, 1);
+    ASSERT_EQ(tracked::copies, 1);
+
+    tracked::copies = tracked::moves = 0;
+    const tracked moved              = std::ranges::iter_move(tracked_iterator<true>(a));
+    ASSERT_EQ(moved.value, 1);
+    ASSERT_EQ(tracked::copies, 0);
+    ASSERT_EQ(tracked::moves, 1);
+
+    // Rotating left by one the way generic algorithms do, through iter_move.
+    const auto rotate = [&a](auto first, auto last) {
+        tracked tmp = std::ranges::iter_move(first);
+        for (auto it = first; it + 1 != last; ++it)
+            *it = std::ranges::iter_move(it + 1);
+        *(last - 1) = std::move(tmp);
+    };
+    tracked::copies = tracked::moves = 0;
+    rotate(tracked_iterator<false>(a), tracked_iterator<false>(a + 4));
+    ASSERT_EQ(tracked::copies, 4);
+    ASSERT_EQ(tracked::moves, 1);
+    tracked::copies = tracked::moves = 0;
+    rotate(tracked_iterator<true>(a), tracked_iterator<true>(a + 4));
+    ASSERT_EQ(tracked::copies, 0);
+    ASSERT_EQ(tracked::moves, 5);
+    ASSERT_EQ(a[0].value, 3);
+    ASSERT_EQ(a[3].value, 2);
+}
+
+TEST(IteratorTest, IterSwapHook) {
+    tracked a[] = {tracked(1), tracked(2)};
+    tracked::copies = tracked::moves = 0;
+    std::ranges::iter_swap(tracked_iterator<true>(a), tracked_iterator<true>(a + 1));
+    ASSERT_EQ(a[0].value, 2);
+    ASSERT_EQ(a[1].value, 1);
+    ASSERT_EQ(tracked::copies, 0);
+    ASSERT_EQ(tracked::moves, 3);
+}
+
 } // namespace iterator_interface
 } // namespace beman
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/leb128_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/leb128_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::input_iterator<leb128_iterator<std::uint32_t, false>>);
+static_assert(!std::forward_iterator<leb128_iterator<std::uint32_t, false>>);
+static_assert(std::sentinel_for<std::default_sentinel_t, leb128_iterator<std::uint64_t, true>>);
+static_assert(std::ranges::input_range<leb128_view<std::uint64_t>>);
+static_assert(std::ranges::view<leb128_view<std::uint32_t, true>>);
+static_assert(std::same_as<std::ranges::range_value_t<leb128_view<std::uint16_t>>, std::uint16_t>);
+
+namespace {
+
+template <class T>
+std::vector<std::byte> encode(const std::vector<T>& values) {
+    std::vector<std::byte> bytes;
+    for (T v : values)
+        leb128_encode(v, std::back_inserter(bytes));
+    return bytes;
+}
+
+template <class T, bool Delta>
+std::vector<T> decode(leb128_view<T, Delta> view) {
+    std::vector<T> v;
+    std::ranges::copy(view, std::back_inserter(v));
+    return v;
+}
+
+// Values of 1 to 10 bytes, mostly short, in runs of one-byte values.
+template <class T>
+std::vector<T> random_values(std::size_t n, unsigned seed) {
+    std::mt19937_64                 gen(seed);
+    std::uniform_int_distribution<> bits(0, std::numeric_limits<T>::digits);
+    std::vector<T>                  v;
+    while (v.size() < n) {
+        const int b = bits(gen);
+        if (b < 8) {
+            for (int i = 0; i != 20; ++i)
+                v.push_back(static_cast<T>(gen() & 0x7f));
+        } else {
+            v.push_back(static_cast<T>(gen() >> (64 - b)));
+        }
+    }
+    v.resize(n);
+    return v;
+}
+
+} // namespace
+
+TEST(Leb128IteratorTest, Encode) {
+    std::vector<std::byte> bytes;
+    leb128_encode(624485u, std::back_inserter(bytes));
+    ASSERT_EQ(bytes, std::vector<std::byte>({std::byte(0xe5), std::byte(0x8e), std::byte(0x26)}));
+    bytes.clear();
+    leb128_encode(std::numeric_limits<std::uint64_t>::max(), std::back_inserter(bytes));
+    ASSERT_EQ(bytes.size(), 10u);
+    ASSERT_EQ(bytes.back(), std::byte(0x01));
+}
+
+TEST(Leb128IteratorTest, RoundTrip) {
+    for (std::size_t n : {0, 1, 7, 8, 9, 127, 128, 129, 1000}) {
+        const auto v32 = random_values<std::uint32_t>(n, 1);
+        const auto b32 = encode(v32);
+        ASSERT_EQ(decode(leb128_view<std::uint32_t>(b32)), v32);
+
+        const auto v64 = random_values<std::uint64_t>(n, 2);
+        const auto b64 = encode(v64);
+        ASSERT_EQ(decode(leb128_view<std::uint64_t>(b64)), v64);
+    }
+
+    const std::vector<std::uint64_t> extremes{0, 127, 128, std::numeric_limits<std::uint64_t>::max(), 1, 1u << 31};
+    ASSERT_EQ(decode(leb128_view<std::uint64_t>(encode(extremes))), extremes);
+}
+
+TEST(Leb128IteratorTest, Runs) {
+    // Runs of values of the same length, which are decoded several at a time,
+    // each followed by a value of another length.
+    std::mt19937_64 gen(5);
+    const auto      value = [&](int length, int digits) {
+        const int bits = std::min(7 * length, digits);
+        return (gen() >> (64 - bits)) | (std::uint64_t(1) << (7 * (length - 1)));
+    };
+    for (int length = 1; length <= 10; ++length) {
+        std::vector<std::uint64_t> v64;
+        std::vector<std::uint32_t> v32;
+        for (int run = 0; run != 200; ++run) {
+            const int n     = static_cast<int>(gen() % 20) + 1;
+            const int other = static_cast<int>(gen() % 10) + 1;
+            for (int i = 0; i != n + 1; ++i) {
+                const int b = i == n ? other : length;
+                v64.push_back(value(b, 64));
+                if (b <= 5)
+                    v32.push_back(static_cast<std::uint32_t>(value(b, 32)));
+            }
+        }
+        ASSERT_EQ(decode(leb128_view<std::uint64_t>(encode(v64))), v64);
+        ASSERT_EQ(decode(leb128_view<std::uint32_t>(encode(v32))), v32);
+    }
+}
+
+TEST(Leb128IteratorTest, Iterator) {
+    const auto                 bytes = encode(std::vector<std::uint32_t>{3, 300, 70000});
+    leb128_view<std::uint32_t> view(bytes);
+    auto                       it = view.begin();
+    ASSERT_EQ(*it, 3u);
+    ASSERT_EQ(*++it, 300u);
+    it++;
+    ASSERT_EQ(*it, 70000u);
+    ASSERT_NE(it, view.end());
+    ASSERT_EQ(++it, view.end());
+
+    // begin() starts over.
+    ASSERT_EQ(*view.begin(), 3u);
+    ASSERT_EQ(std::ranges::distance(view), 3);
+}
+
+TEST(Leb128IteratorTest, Delta) {
+    std::vector<std::uint32_t> ids(1000);
+    std::mt19937               gen(3);
+    std::uint32_t              id = 0;
+    for (auto& i : ids)
+        i = id += static_cast<std::uint32_t>(gen() % 300);
+    std::vector<std::uint32_t> gaps(ids.size());
+    std::adjacent_difference(ids.begin(), ids.end(), gaps.begin());
+    ASSERT_EQ(decode(leb128_view<std::uint32_t, true>(encode(gaps))), ids);
+}
+
+TEST(Leb128IteratorTest, Decode) {
+    const auto                 values = random_values<std::uint64_t>(1000, 4);
+    const auto                 bytes  = encode(values);
+    std::span<const std::byte> rest(bytes);
+    std::vector<std::uint64_t> decoded;
+    std::uint64_t              block[100];
+    while (const std::size_t n = leb128_decode(rest, std::span(block)))
+        decoded.insert(decoded.end(), block, block + n);
+    ASSERT_EQ(decoded, values);
+    ASSERT_TRUE(rest.empty());
+
+    // A truncated last value is dropped with its bytes.
+    const auto                 truncated = encode(std::vector<std::uint32_t>(40, 200));
+    std::vector<std::uint32_t> out(40);
+    rest = std::span(truncated).first(truncated.size() - 1);
+    ASSERT_EQ(leb128_decode(rest, std::span(out)), 39u);
+    ASSERT_TRUE(rest.empty());
+
+    // Decoding stops when out is full.
+    rest = truncated;
+    ASSERT_EQ(leb128_decode(rest, std::span(out).first(17)), 17u);
+    ASSERT_EQ(rest.size(), truncated.size() - 2 * 17);
+}
+
+TEST(Leb128IteratorTest, Malformed) {
+    // A truncated last value is ignored.
+    auto bytes = encode(std::vector<std::uint32_t>(20, 200));
+    bytes.pop_back();
+    ASSERT_EQ(decode(leb128_view<std::uint32_t>(bytes)), std::vector<std::uint32_t>(19, 200));
+
+    // Bits beyond those of T are discarded.
+    const auto wide = encode(std::vector<std::uint64_t>(12, 0x1'0000'0005));
+    ASSERT_EQ(decode(leb128_view<std::uint32_t>(wide)), std::vector<std::uint32_t>(12, 5));
+    ASSERT_EQ(decode(leb128_view<std::uint8_t>(wide)), std::vector<std::uint8_t>(12, 5));
+}
+
+} // namespace iterator_interface
+} // namespace beman
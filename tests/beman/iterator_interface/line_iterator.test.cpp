@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/line_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/line_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+std::vector<std::string_view> split(std::string_view text) {
+    std::vector<std::string_view> result;
+    std::ranges::copy(lines(text), std::back_inserter(result));
+    return result;
+}
+
+// The lines std::getline reads from text.
+std::vector<std::string> getlines(const std::string& text) {
+    std::istringstream       in(text);
+    std::vector<std::string> result;
+    for (std::string line; std::getline(in, line);)
+        result.push_back(line);
+    return result;
+}
+
+constexpr std::ptrdiff_t count_lines(std::string_view text) { return std::ranges::distance(lines(text)); }
+
+} // namespace
+
+static_assert(std::forward_iterator<line_iterator>);
+static_assert(std::sentinel_for<std::default_sentinel_t, line_iterator>);
+static_assert(std::same_as<std::iter_reference_t<line_iterator>, std::string_view>);
+static_assert(count_lines("") == 0);
+static_assert(count_lines("a\n\nb") == 3);
+
+TEST(LineIteratorTest, Lines) {
+    using v = std::vector<std::string_view>;
+    ASSERT_EQ(split(""), v());
+    ASSERT_EQ(split("\n"), v({""}));
+    ASSERT_EQ(split("a"), v({"a"}));
+    ASSERT_EQ(split("a\n"), v({"a"}));
+    ASSERT_EQ(split("a\n\nbc\r\n"), v({"a", "", "bc\r"}));
+
+    const std::string_view text = "first\nsecond";
+    auto                   it   = lines(text).begin();
+    ASSERT_EQ(it->size(), 5u);
+    ASSERT_EQ((*it).data(), text.data());
+    const auto copy = it++;
+    ASSERT_EQ(*copy, "first");
+    ASSERT_EQ(*it, "second");
+    ASSERT_NE(it, copy);
+    ASSERT_EQ(++it, std::default_sentinel);
+}
+
+TEST(LineIteratorTest, MatchesGetline) {
+    // Lines of every length around the 64-byte blocks, and runs of newlines.
+    std::string text;
+    for (int n = 0; n != 200; ++n) {
+        text.append(static_cast<std::size_t>(n % 131), static_cast<char>('a' + n % 26));
+        text.append(n % 7 == 0 ? "\n\n\n" : "\n");
+    }
+    for (std::size_t size = 0; size <= text.size(); size += 1 + size / 16) {
+        const std::string              prefix   = text.substr(0, size);
+        const std::vector<std::string> expected = getlines(prefix);
+        const auto                     found    = split(prefix);
+        ASSERT_TRUE(std::ranges::equal(found, expected)) << "size " << size;
+    }
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/mapped_file.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/mapped_file.hpp>
+
+#if BEMAN_ITERATOR_INTERFACE_HAS_MAPPED_FILE()
+
+    #include <gtest/gtest.h>
+
+    #include <algorithm>
+    #include <cstddef>
+    #include <cstdint>
+    #include <filesystem>
+    #include <fstream>
+    #include <iterator>
+    #include <ranges>
+    #include <string>
+    #include <system_error>
+    #include <utility>
+    #include <vector>
+
+    #if defined(__linux__)
+        #include <sys/syscall.h>
+        #include <unistd.h>
+
+namespace {
+// The bytes whose hints are counted, e.g. a mapping.
+std::uintptr_t watched_first = 0;
+std::uintptr_t watched_last  = 0;
+int            madvise_calls = 0;
+} // namespace
+
+// Counts the hints passed to the kernel for the watched bytes, replacing the
+// C library's madvise.
+extern "C" int madvise(void* addr, std::size_t length, int advice) noexcept {
+    const auto a = reinterpret_cast<std::uintptr_t>(addr);
+    if (a >= watched_first && a < watched_last)
+        ++madvise_calls;
+    return static_cast<int>(::syscall(SYS_madvise, addr, length, advice));
+}
+    #endif
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+struct record {
+    std::uint32_t key;
+    std::uint32_t flags;
+    double        value;
+};
+
+// A file removed on destruction.
+class temp_file {
+  public:
+    explicit temp_file(const std::string& contents)
+        : path_(std::filesystem::temp_directory_path() /
+                ("beman_iterator_interface_mapped_file_" + std::to_string(counter_++))) {
+        std::ofstream(path_, std::ios::binary).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+    ~temp_file() { std::filesystem::remove(path_); }
+
+    std::string path() const { return path_.string(); }
+
+  private:
+    static inline int     counter_ = 0;
+    std::filesystem::path path_;
+};
+
+std::string bytes_of(const std::vector<record>& records) {
+    return std::string(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(record));
+}
+
+} // namespace
+
+static_assert(std::random_access_iterator<record_iterator<record>>);
+static_assert(std::same_as<std::iter_reference_t<record_iterator<record>>, const record&>);
+static_assert(std::ranges::random_access_range<mapped_records<record>>);
+
+TEST(MappedFileTest, Records) {
+    std::vector<record> records;
+    for (std::uint32_t i = 0; i != 1000; ++i)
+        records.push_back({i, i % 3, i * 0.5});
+    // A trailing partial record is ignored.
+    const temp_file file(bytes_of(records) + "xyz");
+
+    const mapped_records<record> m(file.path().c_str());
+    ASSERT_EQ(m.size(), 1000u);
+    ASSERT_EQ(m.file().size(), 1000 * sizeof(record) + 3);
+
+    auto it = m.begin();
+    ASSERT_EQ(&*it, m.data());
+    ASSERT_EQ(it[999].key, 999u);
+    ASSERT_EQ((it + 10)->value, 5.0);
+    it += 500;
+    ASSERT_EQ((*it--).key, 500u);
+    ASSERT_EQ(it->key, 499u);
+    ASSERT_EQ(m.end() - it, 501);
+
+    ASSERT_TRUE(std::ranges::equal(m, records, {}, &record::key, &record::key));
+    std::vector<std::uint32_t> reversed;
+    for (auto r = m.end(); r != m.begin();)
+        reversed.push_back((--r)->key);
+    ASSERT_EQ(reversed.front(), 999u);
+    ASSERT_EQ(reversed.back(), 0u);
+    ASSERT_EQ(std::ranges::count(m, 0u, &record::flags), 334);
+}
+
+    #if defined(__linux__)
+TEST(MappedFileTest, Readahead) {
+    using records_type = mapped_records<record>;
+    std::vector<record> records(static_cast<std::size_t>(3 * records_type::window_records));
+    for (std::size_t i = 0; i != records.size(); ++i)
+        records[i] = {static_cast<std::uint32_t>(i), 0, 0.0};
+    const temp_file file(bytes_of(records));
+
+    // No access pattern is advised for the whole file.
+    mapped_file mapping(file.path().c_str());
+    watched_first = reinterpret_cast<std::uintptr_t>(mapping.data());
+    watched_last  = watched_first + mapping.size();
+    madvise_calls = 0;
+    const records_type m(std::move(mapping));
+    ASSERT_EQ(madvise_calls, 0);
+
+    // A binary search steps once after each jump right: no hint.
+    const auto last = static_cast<std::uint32_t>(records.size() - 1);
+    for (std::uint32_t key : {0u, 1u, 12345u, 400000u, last})
+        ASSERT_EQ(std::ranges::lower_bound(m, key, {}, &record::key)->key, key);
+    ASSERT_EQ(madvise_calls, 0);
+
+    // A scan hints the next window as it enters each one that has a next.
+    std::uint64_t sum = 0;
+    for (auto it = m.begin(); it != m.end(); ++it)
+        sum += it->key;
+    ASSERT_EQ(sum, std::uint64_t(last) * (last + 1) / 2);
+    ASSERT_EQ(madvise_calls, 2);
+
+    // A backward scan hints the window before each one that has one.
+    madvise_calls = 0;
+    for (auto it = m.end(); it != m.begin();)
+        sum -= (--it)->key;
+    ASSERT_EQ(sum, 0u);
+    ASSERT_EQ(madvise_calls, 2);
+}
+    #endif
+
+TEST(MappedFileTest, Empty) {
+    const temp_file              file("");
+    const mapped_records<record> m(file.path().c_str());
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(m.begin(), m.end());
+}
+
+TEST(MappedFileTest, Move) {
+    const temp_file file(bytes_of({{7, 0, 1.0}}));
+    mapped_file     a(file.path().c_str());
+    const auto*     data = a.data();
+    mapped_file     b(std::move(a));
+    ASSERT_EQ(a.data(), nullptr);
+    ASSERT_EQ(b.data(), data);
+    ASSERT_EQ(b.size(), sizeof(record));
+}
+
+TEST(MappedFileTest, Missing) {
+    ASSERT_THROW(mapped_file("/nonexistent/beman_iterator_interface"), std::system_error);
+}
+
+} // namespace iterator_interface
+} // namespace beman
+
+#endif
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/merge_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/merge_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::forward_iterator<merge_iterator<std::vector<int>::const_iterator>>);
+static_assert(std::sized_sentinel_for<merge_iterator<int*>, merge_iterator<int*>>);
+static_assert(!std::bidirectional_iterator<merge_iterator<int*>>);
+static_assert(std::ranges::forward_range<merge_view<int*>>);
+static_assert(std::ranges::sized_range<merge_view<int*>>);
+static_assert(std::ranges::view<merge_view<int*>>);
+static_assert(std::movable<merge_view<int*>> && !std::copyable<merge_view<int*>>);
+
+namespace {
+// Sorted runs of random lengths and values, their stable merge by key, and
+// the merge of each run's (key, run) pairs.
+struct runs_fixture {
+    std::vector<std::vector<std::pair<int, int>>> runs;
+    std::vector<std::pair<int, int>>              expected;
+
+    runs_fixture(int k, int max_size, int max_key) {
+        std::mt19937 gen(static_cast<unsigned>(k));
+        for (int i = 0; i < k; ++i) {
+            std::vector<std::pair<int, int>> run(static_cast<std::size_t>(gen() % (max_size + 1)));
+            for (auto& e : run)
+                e = {static_cast<int>(gen() % (max_key + 1)), i};
+            std::ranges::sort(run);
+            expected.insert(expected.end(), run.begin(), run.end());
+            runs.push_back(std::move(run));
+        }
+        std::ranges::stable_sort(expected, std::less<>(), &std::pair<int, int>::first);
+    }
+};
+
+constexpr auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+} // namespace
+
+TEST(MergeIteratorTest, Increment) {
+    for (int k : {0, 1, 2, 3, 7, 64, 100}) {
+        const runs_fixture f(k, 20, 30);
+        const auto         merged = merge_runs(f.runs, by_key);
+        ASSERT_EQ(merged.size(), f.expected.size());
+        std::vector<std::pair<int, int>> out;
+        for (auto it = merged.begin(); it != merged.end(); ++it)
+            out.push_back(*it);
+        ASSERT_EQ(out, f.expected) << "k = " << k;
+    }
+}
+
+TEST(MergeIteratorTest, CopyDrainsRuns) {
+    for (int k : {1, 2, 5, 33}) {
+        for (int max_key : {0, 3, 1000}) {
+            const runs_fixture f(k, 50, max_key);
+            const auto         merged = merge_runs(f.runs, by_key);
+            std::vector<std::pair<int, int>> out(f.expected.size());
+            ASSERT_EQ(algorithms::copy(merged.begin(), merged.end(), out.begin()), out.end());
+            ASSERT_EQ(out, f.expected) << "k = " << k << ", max_key = " << max_key;
+
+            // The first half in bulk, the second one element by element.
+            const auto                       half = static_cast<std::ptrdiff_t>(f.expected.size() / 2);
+            std::vector<std::pair<int, int>> halves;
+            algorithms::copy_n(merged.begin(), half, std::back_inserter(halves));
+            std::ranges::copy(std::ranges::next(merged.begin(), half), merged.end(), std::back_inserter(halves));
+            ASSERT_EQ(halves, f.expected);
+        }
+    }
+}
+
+TEST(MergeIteratorTest, Multipass) {
+    const runs_fixture f(9, 40, 50);
+    const auto         merged = merge_runs(f.runs, by_key);
+    const auto         values = [&](std::ptrdiff_t i) { return f.expected[static_cast<std::size_t>(i)]; };
+
+    // Neighbouring elements, each read through its own iterator.
+    ASSERT_EQ(std::adjacent_find(merged.begin(), merged.end(), [](const auto& a, const auto& b) {
+                  return b.first < a.first;
+              }),
+              merged.end());
+    ASSERT_TRUE(std::is_sorted(merged.begin(), merged.end(), by_key));
+
+    // Iterators far apart, each read after the other has moved on.
+    auto       behind = merged.begin();
+    auto       ahead  = std::next(merged.begin(), 100);
+    const auto size   = static_cast<std::ptrdiff_t>(merged.size());
+    for (std::ptrdiff_t i = 0; i + 107 <= size; i += 7) {
+        ASSERT_EQ(*ahead, values(i + 100));
+        ASSERT_EQ(*behind, values(i));
+        std::advance(ahead, 7);
+        std::advance(behind, 7);
+    }
+
+    // A copy keeps its position while the original is copied out of.
+    auto                             it   = std::next(merged.begin(), 5);
+    const auto                       copy = it;
+    std::vector<std::pair<int, int>> out;
+    algorithms::copy_n(it, size - 5, std::back_inserter(out));
+    ASSERT_EQ(*copy, values(5));
+    ASSERT_TRUE(std::equal(out.begin(), out.end(), f.expected.begin() + 5));
+}
+
+TEST(MergeIteratorTest, KeptIterators) {
+    // std::min_element keeps the first element while it scans the rest of an
+    // ascending merge, std::max_element the last one it passed: neither must
+    // cost more comparisons than a single pass of the merge.
+    const runs_fixture f(64, 100, 1000);
+    std::size_t        calls    = 0;
+    const auto         counted  = [&](const auto& a, const auto& b) { return ++calls, by_key(a, b); };
+    const auto         merged   = merge_runs(f.runs, counted);
+    const std::size_t  one_pass = f.runs.size() + 6 * f.expected.size(); // ceil(log2 64) per element
+    ASSERT_EQ(std::max_element(merged.begin(), merged.end(), by_key).position(),
+              std::max_element(f.expected.begin(), f.expected.end(), by_key) - f.expected.begin());
+    ASSERT_LE(calls, one_pass);
+
+    calls = 0;
+    ASSERT_EQ(*std::min_element(merged.begin(), merged.end(), by_key), f.expected.front());
+    ASSERT_LE(calls, one_pass);
+}
+
+TEST(MergeIteratorTest, ForwardRuns) {
+    const std::vector<std::forward_list<int>> runs = {{9, 4, 1}, {}, {11, 10, 3, 2}, {4, 0}};
+    const auto       descending = merge_runs(runs, std::ranges::greater());
+    std::vector<int> out;
+    algorithms::copy(descending.begin(), descending.end(), std::back_inserter(out));
+    ASSERT_EQ(out, (std::vector<int>{11, 10, 9, 4, 4, 3, 2, 1, 0}));
+    ASSERT_TRUE(std::ranges::equal(descending, out));
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/partition.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/partition.hpp>
+
+#include <beman/iterator_interface/filter_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+// Whether argument-dependent lookup finds partition_range for It.
+template <class It>
+concept adl_finds_partition_range = requires(It it) { partition_range(it, it, 2); };
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+struct is_multiple_of_3 {
+    bool operator()(int i) const { return i % 3 == 0; }
+};
+
+// The parts are consecutive and cover [first, last).
+template <class It>
+void expect_covers(const std::vector<std::ranges::subrange<It>>& parts, It first, It last) {
+    ASSERT_FALSE(parts.empty());
+    ASSERT_EQ(parts.front().begin(), first);
+    for (std::size_t i = 1; i < parts.size(); ++i)
+        ASSERT_EQ(parts[i - 1].end(), parts[i].begin());
+    ASSERT_EQ(parts.back().end(), last);
+}
+
+} // namespace
+
+// The algorithms are only found when asked for, even for the iterators of
+// this library.
+static_assert(!adl_finds_partition_range<filter_iterator<std::vector<int>::iterator, is_multiple_of_3>>);
+
+TEST(PartitionTest, RandomAccess) {
+    for (int size : {0, 1, 5, 16, 17, 100}) {
+        for (int n : {1, 2, 3, 7, 16, 200}) {
+            std::vector<int> v(static_cast<std::size_t>(size));
+            const auto       parts = algorithms::partition_range(v.begin(), v.end(), n);
+            ASSERT_EQ(parts.size(), static_cast<std::size_t>(n));
+            expect_covers(parts, v.begin(), v.end());
+            for (const auto& part : parts) {
+                ASSERT_GE(part.size(), static_cast<std::size_t>(size / n));
+                ASSERT_LE(part.size(), static_cast<std::size_t>(size / n + 1));
+            }
+        }
+    }
+}
+
+TEST(PartitionTest, Forward) {
+    std::forward_list<int> l(10);
+    const auto             parts = algorithms::partition_range(l.begin(), l.end(), 4);
+    ASSERT_EQ(parts.size(), 4u);
+    expect_covers(parts, l.begin(), l.end());
+    std::vector<std::ptrdiff_t> sizes;
+    for (const auto& part : parts)
+        sizes.push_back(std::ranges::distance(part));
+    ASSERT_EQ(sizes, std::vector<std::ptrdiff_t>({3, 3, 2, 2}));
+}
+
+TEST(PartitionTest, FilterSplitHook) {
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+    filter_view view(v.data(), v.data() + v.size(), is_multiple_of_3{});
+
+    const auto parts = algorithms::partition_range(view.begin(), view.end(), 4);
+    ASSERT_EQ(parts.size(), 4u);
+    expect_covers(parts, view.begin(), view.end());
+    // Cut at 250, 500 and 750 in the underlying range, then moved to the
+    // next multiple of 3.
+    ASSERT_EQ(*parts[1].begin(), 252);
+    ASSERT_EQ(*parts[2].begin(), 501);
+    ASSERT_EQ(*parts[3].begin(), 750);
+
+    std::ptrdiff_t total = 0;
+    for (const auto& part : parts)
+        total += std::ranges::distance(part);
+    ASSERT_EQ(total, std::ranges::distance(view));
+}
+
+TEST(PartitionTest, FilterSplitHookSubrange) {
+    // The cuts stay within [first, last) when last is not the end of the view.
+    std::vector<int> v{3, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 6};
+    filter_view      view(v.data(), v.data() + v.size(), is_multiple_of_3{});
+    const auto       first = view.begin();
+    const auto       last  = std::next(first);
+
+    const auto parts = algorithms::partition_range(first, last, 3);
+    ASSERT_EQ(parts.size(), 3u);
+    expect_covers(parts, first, last);
+    ASSERT_EQ(std::ranges::distance(parts[0]), 1);
+    ASSERT_TRUE(parts[1].empty());
+    ASSERT_TRUE(parts[2].empty());
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/prefetch_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/prefetch_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::random_access_iterator<prefetch_iterator<int*>>);
+static_assert(std::random_access_iterator<prefetch_iterator<std::vector<int>::const_iterator, 4>>);
+static_assert(std::forward_iterator<prefetch_iterator<std::forward_list<int>::iterator>>);
+static_assert(std::forward_iterator<prefetch_iterator<std::list<int>::iterator>>);
+static_assert(!std::bidirectional_iterator<prefetch_iterator<std::list<int>::iterator>>);
+static_assert(sizeof(prefetch_iterator<int*>) == 2 * sizeof(int*));
+
+TEST(PrefetchIteratorTest, RandomAccess) {
+    std::vector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+    using iterator = prefetch_iterator<std::vector<int>::iterator, 8>;
+    const iterator first(v.begin(), v.end());
+    const iterator last(v.end(), v.end());
+    ASSERT_EQ(last - first, 100);
+    ASSERT_EQ(std::accumulate(first, last, 0), 4950);
+    ASSERT_EQ(first[42], 42);
+    ASSERT_EQ(*(first + 99), 99);
+    ASSERT_EQ((last - 1).base(), v.end() - 1);
+    ASSERT_TRUE(first < last);
+
+    // Walking up to the end never prefetches past it.
+    iterator it = first + 95;
+    for (int i = 95; it != last; ++it, ++i)
+        ASSERT_EQ(*it, i);
+
+    *std::ranges::find(first, last, 7) = -7;
+    ASSERT_EQ(v[7], -7);
+}
+
+TEST(PrefetchIteratorTest, ForwardKeepsLookahead) {
+    for (int n : {0, 1, 3, 4, 5, 20}) {
+        std::forward_list<int> l(static_cast<std::size_t>(n));
+        std::iota(l.begin(), l.end(), 0);
+        using iterator = prefetch_iterator<std::forward_list<int>::iterator, 4>;
+        const iterator first(l.begin(), l.end());
+        const iterator last(l.end(), l.end());
+        ASSERT_EQ(std::distance(first, last), n);
+        std::vector<int> out;
+        std::ranges::copy(first, last, std::back_inserter(out));
+        std::vector<int> expected(static_cast<std::size_t>(n));
+        std::iota(expected.begin(), expected.end(), 0);
+        ASSERT_EQ(out, expected);
+    }
+}
+
+TEST(PrefetchIteratorTest, Pointers) {
+    int              storage[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<int> sorted(std::begin(storage), std::end(storage));
+    prefetch_iterator<int*, 2> first(std::begin(storage), std::end(storage));
+    prefetch_iterator<int*, 2> last(std::end(storage), std::end(storage));
+    std::sort(first, last);
+    std::ranges::sort(sorted);
+    ASSERT_TRUE(std::equal(std::begin(storage), std::end(storage), sorted.begin()));
+}
+
+} // namespace iterator_interface
+} // namespace beman
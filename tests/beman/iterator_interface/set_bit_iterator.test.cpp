@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/set_bit_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/set_bit_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::forward_iterator<set_bit_iterator<>>);
+static_assert(std::forward_iterator<set_bit_iterator<std::uint8_t, 3>>);
+static_assert(std::sentinel_for<std::default_sentinel_t, set_bit_iterator<>>);
+static_assert(std::same_as<std::iter_value_t<set_bit_iterator<>>, std::ptrdiff_t>);
+static_assert(std::ranges::forward_range<decltype(set_bit_indices(static_cast<std::uint64_t*>(nullptr), 0))>);
+
+namespace {
+
+// Words with about one bit in 1 << sparsity set, and a run of zero words to
+// skip.
+std::vector<std::uint64_t> random_words(std::size_t n, int sparsity, unsigned seed) {
+    std::mt19937_64            gen(seed);
+    std::vector<std::uint64_t> words(n);
+    for (auto& w : words) {
+        w = ~std::uint64_t(0);
+        for (int i = 0; i != sparsity; ++i)
+            w &= gen();
+    }
+    std::fill(words.begin() + static_cast<std::ptrdiff_t>(n / 4), words.begin() + static_cast<std::ptrdiff_t>(n / 2),
+              0);
+    return words;
+}
+
+template <class R>
+std::vector<std::ptrdiff_t> to_vector(R&& r) {
+    std::vector<std::ptrdiff_t> v;
+    std::ranges::copy(r, std::back_inserter(v));
+    return v;
+}
+
+std::vector<std::ptrdiff_t> indices(const std::vector<std::uint64_t>& a, std::ptrdiff_t size) {
+    std::vector<std::ptrdiff_t> v;
+    for (std::ptrdiff_t i = 0; i != size; ++i) {
+        if (bit_iterator<const std::uint64_t>(a.data())[i])
+            v.push_back(i);
+    }
+    return v;
+}
+
+} // namespace
+
+TEST(SetBitIteratorTest, Indices) {
+    const std::uint64_t words[] = {0b1001, 0, 0, std::uint64_t(1) << 63, 0b10};
+    ASSERT_EQ(to_vector(set_bit_indices(words, 320)), std::vector<std::ptrdiff_t>({0, 3, 255, 257}));
+    ASSERT_EQ(to_vector(set_bit_indices(words, 257)), std::vector<std::ptrdiff_t>({0, 3, 255}));
+    ASSERT_EQ(to_vector(set_bit_indices(words, 4)), std::vector<std::ptrdiff_t>({0, 3}));
+    ASSERT_TRUE(std::ranges::empty(set_bit_indices(words, 0)));
+    ASSERT_TRUE(std::ranges::empty(set_bit_indices(words + 1, 128)));
+
+    auto r  = set_bit_indices(words, 320);
+    auto it = r.begin();
+    auto jt = it++;
+    ASSERT_EQ(*jt, 0);
+    ASSERT_EQ(*it, 3);
+    ASSERT_NE(it, jt);
+    ASSERT_EQ(++jt, it);
+    ASSERT_EQ(std::ranges::distance(r), 4);
+
+    // Other word sizes.
+    const std::uint8_t bytes[] = {0x80, 0x01, 0xff};
+    ASSERT_EQ(to_vector(set_bit_indices(bytes, 19)), std::vector<std::ptrdiff_t>({7, 8, 16, 17, 18}));
+}
+
+TEST(SetBitIteratorTest, MatchesBits) {
+    for (int sparsity : {0, 1, 3, 8}) {
+        const auto words = random_words(100, sparsity, static_cast<unsigned>(sparsity));
+        for (std::ptrdiff_t size : {0, 1, 63, 64, 65, 1000, 6399, 6400})
+            ASSERT_EQ(to_vector(set_bit_indices(words.data(), size)), indices(words, size));
+    }
+}
+
+TEST(SetBitIteratorTest, Intersection) {
+    for (int sparsity : {0, 1, 2, 4}) {
+        const auto a = random_words(100, sparsity, 1);
+        const auto b = random_words(100, sparsity, 2);
+        auto       c = a;
+        for (std::size_t i = 0; i != c.size(); ++i)
+            c[i] &= b[i];
+        for (std::ptrdiff_t size : {0, 1, 64, 1000, 6399, 6400})
+            ASSERT_EQ(to_vector(set_bit_indices(a.data(), b.data(), size)), indices(c, size));
+
+        // Three ways, with a full bitmap.
+        const std::vector<std::uint64_t>         d(100, ~std::uint64_t(0));
+        const set_bit_iterator<std::uint64_t, 3> first({a.data(), b.data(), d.data()}, 6400);
+        ASSERT_EQ(to_vector(std::ranges::subrange(first, std::default_sentinel)), indices(c, 6400));
+    }
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/strided_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/algorithm.hpp>
+#include <beman/iterator_interface/strided_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+static_assert(std::random_access_iterator<strided_iterator<int, 4>>);
+static_assert(std::random_access_iterator<strided_iterator<const int>>);
+static_assert(!std::contiguous_iterator<strided_iterator<int, 1>>);
+static_assert(std::ranges::sized_range<decltype(strided<2>(static_cast<int*>(nullptr), 0))>);
+
+// A compile-time stride takes no space.
+static_assert(sizeof(strided_iterator<int, 4>) == 2 * sizeof(int*));
+static_assert(sizeof(strided_iterator<int>) == 3 * sizeof(int*));
+
+// The algorithm.hpp functions take the indexed loops.
+static_assert(detail::bulk_readable<strided_iterator<const float, 4>, float*>);
+static_assert(detail::bulk_writable<strided_iterator<float>, const float*>);
+static_assert(detail::has_transform<strided_iterator<const float, 4>, float*, float (*)(float)>);
+static_assert(
+    detail::has_transform_to_pointer<strided_iterator<float>, std::vector<float>::iterator, float (*)(float)>);
+
+TEST(StridedIteratorTest, Columns) {
+    // A 4 x 3 row-major matrix.
+    std::vector<int> m(12);
+    std::iota(m.begin(), m.end(), 0);
+
+    const auto column = strided<3>(m.data() + 1, 4);
+    ASSERT_EQ(std::vector<int>(column.begin(), column.end()), std::vector<int>({1, 4, 7, 10}));
+    ASSERT_EQ(std::ranges::size(column), 4u);
+
+    auto it = column.begin();
+    ASSERT_EQ(it[2], 7);
+    it += 3;
+    ASSERT_EQ(*it, 10);
+    ASSERT_EQ(&*it, m.data() + 10);
+    ASSERT_EQ(it.base(), m.data() + 1);
+    ASSERT_EQ(it.index(), 3);
+    ASSERT_EQ(column.end().base(), m.data() + 1);
+    ASSERT_EQ(column.end().index(), 4);
+    ASSERT_EQ(*--it, 7);
+    ASSERT_EQ(column.end() - it, 2);
+    ASSERT_LT(it, column.end());
+
+    const auto dynamic = strided(m.data() + 2, 3, 4);
+    ASSERT_EQ(dynamic.begin().stride(), 3);
+    ASSERT_EQ(std::vector<int>(dynamic.begin(), dynamic.end()), std::vector<int>({2, 5, 8, 11}));
+
+    // Backwards along the last row.
+    const auto reversed = strided(m.data() + 11, -1, 3);
+    ASSERT_EQ(std::vector<int>(reversed.begin(), reversed.end()), std::vector<int>({11, 10, 9}));
+}
+
+TEST(StridedIteratorTest, BulkTransfer) {
+    std::vector<float> frames(4 * 100);
+    std::iota(frames.begin(), frames.end(), 0.0f);
+
+    // Deinterleave channel 2, then write it back to channel 0 scaled.
+    std::vector<float> channel(100);
+    const auto         in = strided<4>(std::as_const(frames).data() + 2, 100);
+    ASSERT_EQ(algorithms::copy(in.begin(), in.end(), channel.data()), channel.data() + 100);
+    for (std::size_t i = 0; i != channel.size(); ++i)
+        ASSERT_EQ(channel[i], static_cast<float>(4 * i + 2));
+
+    const auto out = strided(frames.data(), 4, 100);
+    algorithms::copy(channel.begin(), channel.end(), out.begin());
+    ASSERT_TRUE(std::ranges::equal(out, in));
+
+    std::vector<float> halves(100);
+    algorithms::transform(in.begin(), in.end(), halves.begin(), [](float x) { return x / 2; });
+    algorithms::transform(halves.begin(), halves.end(), out.begin(), [](float x) { return x * 2; });
+    ASSERT_TRUE(std::ranges::equal(out, in));
+    ASSERT_EQ(halves[99], 199.0f);
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/transform_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/transform_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+namespace {
+
+struct square {
+    int operator()(int i) const { return i * i; }
+};
+
+struct first_member {
+    int& operator()(std::pair<int, int>& p) const { return p.first; }
+};
+
+// Counts its calls in *count.
+struct counting_square {
+    int* count = nullptr;
+    int  operator()(int i) const {
+        ++*count;
+        return i * i;
+    }
+};
+
+template <std::size_t Cache>
+using square_iterator = transform_iterator<int*, square, Cache>;
+
+} // namespace
+
+static_assert(std::random_access_iterator<square_iterator<0>>);
+static_assert(std::random_access_iterator<square_iterator<3>>);
+static_assert(!std::contiguous_iterator<square_iterator<0>>);
+static_assert(std::bidirectional_iterator<transform_iterator<std::list<int>::iterator, square>>);
+static_assert(!std::random_access_iterator<transform_iterator<std::list<int>::iterator, square>>);
+static_assert(std::forward_iterator<transform_iterator<std::forward_list<int>::iterator, square>>);
+static_assert(!std::bidirectional_iterator<transform_iterator<std::forward_list<int>::iterator, square>>);
+static_assert(std::ranges::random_access_range<transform_view<int*, square>>);
+static_assert(std::ranges::sized_range<transform_view<int*, square, 3>>);
+
+static_assert(std::same_as<std::iter_reference_t<square_iterator<0>>, int>);
+static_assert(std::same_as<std::iter_reference_t<square_iterator<3>>, int>);
+static_assert(std::same_as<std::iter_reference_t<transform_iterator<std::pair<int, int>*, first_member>>, int&>);
+
+// The function and the cache live in the view.
+static_assert(sizeof(square_iterator<0>) == 2 * sizeof(int*));
+static_assert(sizeof(square_iterator<3>) == 2 * sizeof(int*));
+
+TEST(TransformIteratorTest, RandomAccess) {
+    int                   a[] = {0, 1, 2, 3, 4};
+    transform_view        v(a, a + 5, square{});
+    std::vector<int>      squares(v.begin(), v.end());
+    ASSERT_EQ(squares, std::vector<int>({0, 1, 4, 9, 16}));
+    ASSERT_EQ(std::ranges::size(v), 5u);
+
+    auto it = v.begin();
+    ASSERT_EQ(it[3], 9);
+    ASSERT_EQ(*(it + 4), 16);
+    it += 2;
+    ASSERT_EQ(*it--, 4);
+    ASSERT_EQ(*it, 1);
+    ASSERT_EQ(it.base(), a + 1);
+    ASSERT_EQ(v.end() - it, 4);
+}
+
+TEST(TransformIteratorTest, Bidirectional) {
+    std::list<int>   l{1, 2, 3};
+    transform_view   v(l.begin(), l.end(), square{});
+    std::vector<int> reversed;
+    for (auto it = v.end(); it != v.begin();)
+        reversed.push_back(*--it);
+    ASSERT_EQ(reversed, std::vector<int>({9, 4, 1}));
+}
+
+TEST(TransformIteratorTest, ReferenceResult) {
+    std::vector<std::pair<int, int>> pairs{{1, 10}, {2, 20}};
+    transform_view                   v(pairs.begin(), pairs.end(), first_member{});
+    std::ranges::fill(v, 7);
+    ASSERT_EQ(pairs, (std::vector<std::pair<int, int>>{{7, 10}, {7, 20}}));
+}
+
+TEST(TransformIteratorTest, Arrow) {
+    std::vector<int> v{1, 22, 333};
+    auto             to_string = [](int i) { return std::to_string(i); };
+    transform_view   plain(v.begin(), v.end(), to_string);
+    ASSERT_EQ(std::next(plain.begin())->size(), 2u);
+
+    transform_view<std::vector<int>::iterator, decltype(to_string), 3> cached(v.begin(), v.end(), to_string);
+    auto                                                                 it = std::next(cached.begin(), 2);
+    ASSERT_EQ(it->size(), 3u);
+    ASSERT_EQ(*it, "333");
+}
+
+TEST(TransformIteratorTest, CachedCalls) {
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Compares each element to the next one, as std::adjacent_find and
+    // std::is_sorted do, with explicit increments and dereferences so that
+    // the call counts do not depend on the standard library.
+    const auto sorted = [](auto first, auto last) {
+        bool result = true;
+        for (auto next = first; ++next != last; first = next) {
+            if (*next < *first)
+                result = false;
+        }
+        return result;
+    };
+
+    int            plain_calls = 0;
+    transform_view plain(a, a + 8, counting_square{&plain_calls});
+    ASSERT_TRUE(sorted(plain.begin(), plain.end()));
+    ASSERT_TRUE(sorted(plain.begin(), plain.end()));
+
+    int                                      cached_calls = 0;
+    transform_view<int*, counting_square, 3> cached(a, a + 8, counting_square{&cached_calls});
+    ASSERT_TRUE(sorted(cached.begin(), cached.end()));
+    ASSERT_TRUE(sorted(cached.begin(), cached.end()));
+
+    // Each pass dereferences every inner element twice, which calls the
+    // function twice without the cache and once with it.
+    ASSERT_EQ(plain_calls, 2 * (2 * 8 - 2));
+    ASSERT_EQ(cached_calls, 2 * 8);
+
+    // The last two positions dereferenced hit the cache, from any iterator.
+    cached_calls = 0;
+    auto it      = cached.begin();
+    ASSERT_EQ(*it + *it, 1 + 1);
+    ASSERT_EQ(*++it, 4);
+    ASSERT_EQ(*--it, 1);
+    ASSERT_EQ(*(it + 1), 4);
+    ASSERT_EQ(cached_calls, 2);
+    ASSERT_EQ(*(it += 3), 16);
+    ASSERT_EQ(it[1], 25);
+    ASSERT_EQ(*cached.begin(), 1);
+    ASSERT_EQ(cached_calls, 5);
+}
+
+} // namespace iterator_interface
+} // namespace beman
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// tests/beman/iterator_interface/zip_iterator.test.cpp -*-C++-*-
+
+#include <beman/iterator_interface/zip_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace beman {
+namespace iterator_interface {
+
+using int_string_iterator = zip_iterator<std::vector<int>::iterator, std::vector<std::string>::iterator>;
+
+static_assert(std::random_access_iterator<int_string_iterator>);
+static_assert(std::sortable<int_string_iterator>);
+static_assert(std::same_as<std::iter_value_t<int_string_iterator>, std::tuple<int, std::string>>);
+static_assert(std::same_as<std::iter_rvalue_reference_t<int_string_iterator>, zip_reference<int&&, std::string&&>>);
+static_assert(
+    std::same_as<std::common_reference_t<zip_reference<int&>, zip_reference<int&&>>, zip_reference<const int&>>);
+static_assert(std::bidirectional_iterator<zip_iterator<int*, std::list<int>::iterator>>);
+static_assert(!std::random_access_iterator<zip_iterator<int*, std::list<int>::iterator>>);
+static_assert(std::forward_iterator<zip_iterator<std::forward_list<int>::iterator, const double*>>);
+
+TEST(ZipIteratorTest, ProxyReference) {
+    std::vector<int>    a = {1, 2, 3};
+    std::vector<double> b = {0.5, 1.5, 2.5};
+    zip_iterator        it(a.begin(), b.begin());
+
+    auto [x, y] = *it;
+    x           = 10;
+    y           = 10.5;
+    ASSERT_EQ(a[0], 10);
+    ASSERT_EQ(b[0], 10.5);
+    ASSERT_EQ(get<1>(it[2]), 2.5);
+    ASSERT_EQ(it->get<0>(), 10);
+
+    // Assignment goes through to the elements, also from a value.
+    it[1] = it[2];
+    ASSERT_EQ(a[1], 3);
+    ASSERT_EQ(b[1], 2.5);
+    *it = std::tuple(7, 7.5);
+    ASSERT_EQ(a[0], 7);
+    ASSERT_EQ(b[0], 7.5);
+
+    const std::tuple<int, double> row = it[2];
+    ASSERT_EQ(row, std::tuple(3, 2.5));
+    ASSERT_TRUE(it[1] == it[2]);
+    ASSERT_TRUE(it[2] == row);
+    ASSERT_TRUE(row == it[2]);
+    ASSERT_TRUE(it[0] > it[2]);
+    ASSERT_TRUE(std::tuple(1, 0.0) < it[0]);
+
+    const zip_iterator last(a.end(), b.end());
+    ASSERT_EQ(last - it, 3);
+    ASSERT_EQ(std::get<1>((it + 3).base()), b.end());
+}
+
+TEST(ZipIteratorTest, SortPermutesRows) {
+    std::vector<int>         keys = {5, 3, 9, 1, 4, 7, 0, 8, 2, 6, 15, 11, 13, 10, 12, 14, 19, 17, 16, 18};
+    std::vector<std::string> names;
+    std::vector<double>      weights;
+    for (int k : keys) {
+        names.push_back(std::string(32, static_cast<char>('a' + k)));
+        weights.push_back(k * 0.5);
+    }
+    const zip_iterator first(keys.begin(), names.begin(), weights.begin());
+    const zip_iterator last(keys.end(), names.end(), weights.end());
+
+    std::ranges::sort(first, last, std::ranges::less(), [](const auto& row) { return get<0>(row); });
+    ASSERT_TRUE(std::ranges::is_sorted(keys));
+    for (std::size_t i = 0; i != keys.size(); ++i) {
+        ASSERT_EQ(names[i], std::string(32, static_cast<char>('a' + keys[i])));
+        ASSERT_EQ(weights[i], keys[i] * 0.5);
+    }
+
+    const auto found = std::ranges::lower_bound(first, last, 7, std::ranges::less(), [](const auto& row) {
+        return get<0>(row);
+    });
+    ASSERT_EQ(found - first, 7);
+
+    std::ranges::reverse(first, last);
+    ASSERT_TRUE(std::ranges::is_sorted(keys, std::ranges::greater()));
+    ASSERT_EQ(names.front(), std::string(32, 't'));
+
+    // iter_move moves the elements of the row.
+    const std::tuple<int, std::string, double> row = std::ranges::iter_move(first);
+    ASSERT_EQ(std::get<1>(row), std::string(32, 't'));
+    ASSERT_TRUE(names.front().empty());
+}
+
+TEST(ZipIteratorTest, SortLexicographic) {
+    std::vector<int>  a = {2, 1, 2, 1};
+    std::vector<char> b = {'b', 'z', 'a', 'y'};
+    std::ranges::sort(zip_iterator(a.begin(), b.begin()), zip_iterator(a.end(), b.end()));
+    ASSERT_EQ(a, (std::vector<int>{1, 1, 2, 2}));
+    ASSERT_EQ(b, (std::vector<char>{'y', 'z', 'a', 'b'}));
+}
+
+} // namespace iterator_interface
+} // namespace beman